@@ -5,21 +5,69 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 CPP_SRCS += \
 ../source/Callback.cpp \
+../source/TM1637Animation.cpp \
+../source/TM1637AsyncBus.cpp \
+../source/TM1637Benchmark.cpp \
+../source/TM1637BitBang.cpp \
+../source/TM1637Dimmer.cpp \
 ../source/TM1637Display.cpp \
+../source/TM1637DmaBus.cpp \
+../source/TM1637Font.cpp \
+../source/TM1637Keypad.cpp \
+../source/TM1637Marquee.cpp \
+../source/TM1637MultiDisplay.cpp \
+../source/TM1637Pit.cpp \
 ../source/main.cpp \
-../source/mkl_DevGPIO.cpp 
+../source/mkl_CycleCounter.cpp \
+../source/mkl_DevGPIO.cpp \
+../source/mkl_DevGPIOBus.cpp \
+../source/mkl_DevGPIOCapture.cpp \
+../source/mkl_DevGPIOEvents.cpp \
+../source/mkl_DevGPIOPort.cpp 
 
 OBJS += \
 ./source/Callback.o \
+./source/TM1637Animation.o \
+./source/TM1637AsyncBus.o \
+./source/TM1637Benchmark.o \
+./source/TM1637BitBang.o \
+./source/TM1637Dimmer.o \
 ./source/TM1637Display.o \
+./source/TM1637DmaBus.o \
+./source/TM1637Font.o \
+./source/TM1637Keypad.o \
+./source/TM1637Marquee.o \
+./source/TM1637MultiDisplay.o \
+./source/TM1637Pit.o \
 ./source/main.o \
-./source/mkl_DevGPIO.o 
+./source/mkl_CycleCounter.o \
+./source/mkl_DevGPIO.o \
+./source/mkl_DevGPIOBus.o \
+./source/mkl_DevGPIOCapture.o \
+./source/mkl_DevGPIOEvents.o \
+./source/mkl_DevGPIOPort.o 
 
 CPP_DEPS += \
 ./source/Callback.d \
+./source/TM1637Animation.d \
+./source/TM1637AsyncBus.d \
+./source/TM1637Benchmark.d \
+./source/TM1637BitBang.d \
+./source/TM1637Dimmer.d \
 ./source/TM1637Display.d \
+./source/TM1637DmaBus.d \
+./source/TM1637Font.d \
+./source/TM1637Keypad.d \
+./source/TM1637Marquee.d \
+./source/TM1637MultiDisplay.d \
+./source/TM1637Pit.d \
 ./source/main.d \
-./source/mkl_DevGPIO.d 
+./source/mkl_CycleCounter.d \
+./source/mkl_DevGPIO.d \
+./source/mkl_DevGPIOBus.d \
+./source/mkl_DevGPIOCapture.d \
+./source/mkl_DevGPIOEvents.d \
+./source/mkl_DevGPIOPort.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -7,18 +7,21 @@
 
 #include "Callback.h"
 
-void Callback::attach(std::function<void(void)> f){
-	this->f = f;
-}
+/*
+ * Verificação de compilação do uso documentado em Callback.h: um Callback
+ * global constexpr, sem código de inicialização, que pode ser executado
+ */
+static void constexprCheckTarget() {}
+static constexpr Callback constexprCheck = Callback::bind<&constexprCheckTarget>();
+static_assert(std::is_same<decltype(constexprCheck.exec()), bool>::value,
+		"exec() deve ser chamável em um Callback constexpr");
 
-void Callback::detach(){
-	this->f = NULL;
+void Callback::attach(void (*f)()){
+	this->invoker = nullptr;
+	this->storage.function = f;
+	this->invoker = (f != nullptr) ? &invokePointer : nullptr;
 }
 
-bool Callback::exec(){
-	if ( this-> f){
-		this->f();
-		return true;
-	}
-	return false;
+void Callback::detach(){
+	this->invoker = nullptr;
 }
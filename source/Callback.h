@@ -8,14 +8,103 @@
 
 #pragma once
 
-#include <functional>
+#include <new>
+#include <type_traits>
 
+// Bytes disponíveis para o estado de uma lambda (capturas)
+#define CALLBACK_STORAGE 8
+
+/*
+ * Função de tamanho fixo, sem alocação dinâmica, para uso em interrupções.
+ *
+ * Guarda um ponteiro de invocação e um pequeno buffer: o objeto de uma função
+ * membro, o ponteiro de uma função livre ou as capturas de uma lambda. exec()
+ * faz uma única chamada indireta para alvos ligados em tempo de compilação
+ * (bind<&f>() e bind<T, &T::m>(obj)). O construtor é constexpr, de modo que um
+ * Callback global é inicializado sem código de inicialização.
+ *
+ *   static constexpr Callback onTick = Callback::bind<&tick>();
+ *   gpio.attach<Controller, &Controller::onEdge>(controller);
+ *   gpio.attach([]() { count++; });
+ */
 class Callback{
 
 protected:
-	std::function<void(void)> f;
+	union Storage {
+		void *object;
+		void (*function)();
+		alignas(void *) unsigned char bytes[CALLBACK_STORAGE];
+
+		constexpr Storage() : object(nullptr) {}
+		constexpr Storage(void *object) : object(object) {}
+		constexpr Storage(void (*function)()) : function(function) {}
+	};
+
+	typedef void (*Invoker)(const Storage &storage);
+
+	Invoker invoker;
+	Storage storage;
+
+	constexpr Callback(Invoker invoker, Storage storage)
+		: invoker(invoker), storage(storage) {}
+
+	template<void (*F)()>
+	static void invokeStatic(const Storage &) { F(); }
+
+	template<class T, void (T::*M)()>
+	static void invokeMember(const Storage &storage) { (static_cast<T *>(storage.object)->*M)(); }
+
+	template<class F>
+	static void invokeFunctor(const Storage &storage) {
+		(*reinterpret_cast<const F *>(storage.bytes))();
+	}
+
+	static void invokePointer(const Storage &storage) { storage.function(); }
+
 public:
-	void attach(std::function<void(void)> f);
+	constexpr Callback() : invoker(nullptr), storage() {}
+
+	// Função livre conhecida em tempo de compilação
+	template<void (*F)()>
+	static constexpr Callback bind() {
+		return Callback(&invokeStatic<F>, Storage());
+	}
+
+	// Função membro conhecida em tempo de compilação, sobre um objeto
+	template<class T, void (T::*M)()>
+	static constexpr Callback bind(T &object) {
+		return Callback(&invokeMember<T, M>, Storage((void *)&object));
+	}
+
+	// Ponteiro de função em tempo de execução (duas chamadas indiretas)
+	void attach(void (*f)());
+
+	template<class T, void (T::*M)()>
+	void attach(T &object) {
+		*this = bind<T, M>(object);
+	}
+
+	// Lambda ou functor pequeno, copiado para o buffer interno
+	template<class F>
+	void attach(const F &functor) {
+		static_assert(sizeof(F) <= CALLBACK_STORAGE, "capturas maiores que CALLBACK_STORAGE");
+		static_assert(alignof(F) <= alignof(Storage), "alinhamento das capturas");
+		static_assert(std::is_trivially_copyable<F>::value, "capturas devem ser copiáveis byte a byte");
+
+		invoker = nullptr;
+		new (storage.bytes) F(functor);
+		invoker = &invokeFunctor<F>;
+	}
+
 	void detach();
-	bool exec();
+
+	bool exec() const {
+		Invoker f = invoker;
+
+		if (f != nullptr) {
+			f(storage);
+			return true;
+		}
+		return false;
+	}
 };
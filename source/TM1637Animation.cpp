@@ -0,0 +1,199 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Animações em flash com quadros codificados por diferença.
+ *
+ * @file        TM1637Animation.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637Animation.h"
+#include "fsl_clock.h"
+#include "mkl_CycleCounter.h"
+
+static mkl_CycleCounter frameCounter;
+
+/*
+ * Um segmento percorre o contorno dos 4 dígitos: topo da esquerda para a
+ * direita, lado direito, base da direita para a esquerda e lado esquerdo.
+ * Cada passo apaga o dígito anterior e acende o seguinte (4 bytes por quadro).
+ */
+static const uint8_t spinnerData[] = {
+	5, TM1637_ANIM_FILL(0x0E), 0, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x01), SEG_A,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x03), 0, SEG_A,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x06), 0, SEG_A,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x0C), 0, SEG_A,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x08), SEG_B,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x08), SEG_C,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x08), SEG_D,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x0C), SEG_D, 0,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x06), SEG_D, 0,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x03), SEG_D, 0,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x01), SEG_E,
+	5, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x01), SEG_F,
+};
+
+const tm1637_Animation tm1637_animSpinner = TM1637_ANIMATION(spinnerData, 4, 12);
+
+/*
+ * Barra que cresce um traço por dígito e pisca cheia antes de recomeçar
+ */
+static const uint8_t loadingData[] = {
+	20, TM1637_ANIM_END | TM1637_ANIM_FILL(0x0F), 0,
+	20, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x01), SEG_G,
+	20, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x02), SEG_G,
+	20, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x04), SEG_G,
+	20, TM1637_ANIM_END | TM1637_ANIM_DELTA(0x08), SEG_G,
+	20, TM1637_ANIM_END | TM1637_ANIM_FILL(0x0F), SEG_A | SEG_G | SEG_D,
+};
+
+const tm1637_Animation tm1637_animLoading = TM1637_ANIMATION(loadingData, 4, 6);
+
+TM1637Animator::TM1637Animator(TM1637Core &display, pit_chnl_t channel)
+		: display(display)
+{
+	pitChannel = channel;
+}
+
+void TM1637Animator::setTick(uint16_t tickMs)
+{
+	this->tickMs = (tickMs != 0) ? tickMs : 1;
+}
+
+void TM1637Animator::play(const tm1637_Animation &animation, uint8_t loops)
+{
+	pit_config_t config;
+
+	stop();
+
+	this->animation = &animation;
+	this->loops = loops;
+	position = 0;
+	remaining = 0;
+	pass = 0;
+
+	for (uint8_t k = 0; k < TM1637_MAX_DIGITS; k++)
+		frame[k] = 0;
+
+	PIT_GetDefaultConfig(&config);
+	PIT_Init(PIT, &config);
+	PIT_SetTimerPeriod(PIT, pitChannel, CLOCK_GetBusClkFreq() / 1000 * tickMs - 1);
+	tm1637_attachPit(pitChannel, this);
+
+	playing = true;
+	PIT_StartTimer(PIT, pitChannel);
+}
+
+void TM1637Animator::stop()
+{
+	if (!playing)
+		return;
+
+	PIT_StopTimer(PIT, pitChannel);
+	playing = false;
+}
+
+bool TM1637Animator::isPlaying() const
+{
+	return playing;
+}
+
+uint16_t TM1637Animator::flashBytes(const tm1637_Animation &animation)
+{
+	return animation.size + sizeof(tm1637_Animation);
+}
+
+tm1637_AnimationStats TM1637Animator::getStats() const
+{
+	return stats;
+}
+
+void TM1637Animator::resetStats()
+{
+	stats.frames = 0;
+	stats.skipped = 0;
+	stats.frameCycles = 0;
+	stats.maxFrameCycles = 0;
+}
+
+void TM1637Animator::handleInterrupt()
+{
+	PIT_ClearStatusFlags(PIT, pitChannel, kPIT_TimerFlag);
+
+	if (!playing)
+		return;
+
+	if (remaining > 1) {
+		remaining--;
+		return;
+	}
+
+	if (!display.isIdle()) {
+		stats.skipped++;
+		return;
+	}
+
+	// Fim dos dados: recomeça pelo primeiro quadro ou para
+	if (position >= animation->size) {
+		if (loops != 0 && ++pass >= loops) {
+			stop();
+			return;
+		}
+		position = 0;
+	}
+
+	frameCounter.start();
+
+	decodeFrame();
+	display.setSegments(frame, first, (numLength)animation->width);
+
+	uint32_t cycles = frameCounter.elapsed();
+	stats.frames++;
+	stats.frameCycles += cycles;
+	if (cycles > stats.maxFrameCycles)
+		stats.maxFrameCycles = cycles;
+}
+
+void TM1637Animator::decodeFrame()
+{
+	const uint8_t *data = animation->data;
+	uint8_t op;
+
+	remaining = data[position++];
+
+	do {
+		op = data[position++];
+		uint8_t mask = op & 0x3F;
+
+		if (op & 0x40) {
+			uint8_t value = data[position++];
+
+			for (uint8_t k = 0; k < TM1637_MAX_DIGITS; k++) {
+				if (mask & (1 << k))
+					frame[k] = value;
+			}
+		}
+		else {
+			for (uint8_t k = 0; k < TM1637_MAX_DIGITS; k++) {
+				if (mask & (1 << k))
+					frame[k] = data[position++];
+			}
+		}
+	} while (!(op & TM1637_ANIM_END));
+}
@@ -0,0 +1,166 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Animações em flash com quadros codificados por diferença.
+ *
+ * @file        TM1637Animation.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637ANIMATION__
+#define __TM1637ANIMATION__
+
+#include <inttypes.h>
+#include "fsl_pit.h"
+#include "TM1637Display.h"
+#include "TM1637Pit.h"
+
+/*
+ * Formato de uma animação, em bytes na flash:
+ *
+ *   quadro   = duração, operação, ..., operação com TM1637_ANIM_END
+ *   operação = TM1637_ANIM_DELTA(máscara), um byte de segmentos por bit da máscara
+ *            | TM1637_ANIM_FILL(máscara), um byte repetido em todas as posições da máscara
+ *
+ * A duração é contada em ticks do player (10 ms por padrão) e a máscara tem um
+ * bit por posição (bit 0 = posição mais à esquerda). Cada quadro só descreve as
+ * posições que mudam em relação ao anterior; o primeiro quadro deve definir
+ * todas as posições da animação, pois ele também sucede o último quando a
+ * animação se repete.
+ */
+#define TM1637_ANIM_DELTA(mask)  ((uint8_t)((mask) & 0x3F))
+#define TM1637_ANIM_FILL(mask)   ((uint8_t)(0x40 | ((mask) & 0x3F)))
+#define TM1637_ANIM_END          0x80
+
+/*!
+ * Animação guardada na flash
+ */
+struct tm1637_Animation {
+	const uint8_t *data;	// Quadros codificados
+	uint16_t size;			// Bytes de data
+	uint8_t width;			// Posições usadas, a partir da primeira
+	uint8_t frames;			// Quadros por repetição
+};
+
+#define TM1637_ANIMATION(data, width, frames) { data, sizeof(data), width, frames }
+
+/*!
+ * Estatísticas do player
+ */
+struct tm1637_AnimationStats {
+	uint32_t frames;			// Quadros decodificados e enviados
+	uint32_t skipped;			// Ticks adiados por uma escrita em andamento
+	uint32_t frameCycles;		// Ciclos gastos na decodificação e envio
+	uint32_t maxFrameCycles;	// Pior caso de um único quadro
+};
+
+/*!
+ * Animações de exemplo, em TM1637Animation.cpp
+ */
+extern const tm1637_Animation tm1637_animSpinner;	// Segmento girando pelo contorno de 4 dígitos
+extern const tm1637_Animation tm1637_animLoading;	// Barra de progresso em 4 dígitos
+
+/*!
+ *  @class    TM1637Animator
+ *
+ *  @brief    Player de animações avançado pelo PIT.
+ *
+ *  @details  A cada tick do canal do PIT o player desconta a duração do quadro
+ *            atual; ao terminar, decodifica o próximo quadro sobre o quadro
+ *            anterior e o passa a setSegments(), que envia apenas os dígitos
+ *            alterados. Se o display estiver ocupado, o quadro é adiado para o
+ *            tick seguinte.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              TM1637Animator animator(display);
+ *              animator.play(tm1637_animSpinner);
+ *              ...
+ *              animator.stop();
+ */
+class TM1637Animator : public TM1637PitHandler {
+
+public:
+/*!
+ * O KL25Z tem dois canais de PIT: o canal 0 é o padrão de TM1637AsyncBus e o
+ * canal 1 é compartilhado, por padrão, com TM1637Marquee, que não deve rolar
+ * no mesmo display durante uma animação
+ */
+	TM1637Animator(TM1637Core &display, pit_chnl_t channel = kPIT_Chnl_1);
+
+/*!
+ * Define a duração de um tick, aplicada no próximo play()
+ */
+	void setTick(uint16_t tickMs);
+
+/*!
+ * Inicia uma animação a partir do primeiro quadro
+ *
+ * @param loops O número de repetições (0 = sem fim)
+ */
+	void play(const tm1637_Animation &animation, uint8_t loops = 0);
+
+	void stop();
+
+	bool isPlaying() const;
+
+/*!
+ * Bytes de flash ocupados por uma animação, incluindo o descritor
+ */
+	static uint16_t flashBytes(const tm1637_Animation &animation);
+
+/*!
+ * Retorna as estatísticas acumuladas desde a última chamada de resetStats()
+ */
+	tm1637_AnimationStats getStats() const;
+
+	void resetStats();
+
+/*!
+ * Avança um tick; chamado por PIT_IRQHandler via tm1637_attachPit()
+ */
+	void handleInterrupt();
+
+protected:
+/*!
+ * Aplica o próximo quadro da animação sobre @ref frame
+ */
+	void decodeFrame();
+
+private:
+	TM1637Core &display;
+	pit_chnl_t pitChannel;
+	uint16_t tickMs = 10;
+
+	const tm1637_Animation *animation = nullptr;
+	uint8_t frame[TM1637_MAX_DIGITS];
+
+/*!
+ * Estado da reprodução, alterado pela interrupção
+ */
+	volatile bool playing = false;
+	uint16_t position = 0;
+	uint8_t remaining = 0;
+	uint8_t loops = 0;
+	uint8_t pass = 0;
+
+	tm1637_AnimationStats stats = { 0, 0, 0, 0 };
+};
+
+#endif // __TM1637ANIMATION__
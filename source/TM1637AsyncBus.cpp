@@ -0,0 +1,223 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Transmissão assíncrona para o TM1637 por interrupção do PIT.
+ *
+ * @file        TM1637AsyncBus.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637AsyncBus.h"
+#include "fsl_clock.h"
+
+#ifdef TM1637_BENCHMARK
+#include "mkl_CycleCounter.h"
+
+static mkl_CycleCounter isrCounter;
+#endif
+
+TM1637AsyncBus::TM1637AsyncBus(mkl_DevGPIO pinClk, mkl_DevGPIO pinDIO, pit_chnl_t channel)
+{
+	m_pinClk = pinClk;
+	m_pinDIO = pinDIO;
+	pitChannel = channel;
+}
+
+bool TM1637AsyncBus::begin(busFrequency frequency)
+{
+	pit_config_t config;
+
+	if (SystemCoreClock / (TM1637_ASYNC_STEPS_PER_BIT * frequency) < TM1637_ASYNC_MIN_TICK_CYCLES)
+		return false;
+
+	PIT_GetDefaultConfig(&config);
+	PIT_Init(PIT, &config);
+
+	// Um tick do PIT por terço do período de bit
+	uint32_t ticks = CLOCK_GetBusClkFreq() / (TM1637_ASYNC_STEPS_PER_BIT * frequency);
+	PIT_SetTimerPeriod(PIT, pitChannel, ticks - 1);
+
+	tm1637_attachPit(pitChannel, this);
+	return true;
+}
+
+bool TM1637AsyncBus::submit(const tm1637_Transfer &transfer)
+{
+	uint8_t next = (head + 1) & (TM1637_ASYNC_QUEUE_DEPTH - 1);
+
+	if (next == tail)
+		return false;
+
+	queue[head] = transfer;
+	head = next;
+
+	// Com o barramento parado não há interrupção ativa, então o início pode ser
+	// feito daqui. Se a interrupção terminar a fila depois da escrita de head,
+	// ela mesma segue para esta transferência.
+	if (current == stateIdle)
+		startTransfer();
+
+	return true;
+}
+
+bool TM1637AsyncBus::isBusy() const
+{
+	return current != stateIdle || head != tail;
+}
+
+tm1637_AsyncStats TM1637AsyncBus::getStats() const
+{
+	return stats;
+}
+
+void TM1637AsyncBus::resetStats()
+{
+	stats.ticks = 0;
+	stats.isrCycles = 0;
+	stats.maxIsrCycles = 0;
+	stats.nacks = 0;
+}
+
+void TM1637AsyncBus::handleInterrupt()
+{
+#ifdef TM1637_BENCHMARK
+	isrCounter.start();
+#endif
+
+	PIT_ClearStatusFlags(PIT, pitChannel, kPIT_TimerFlag);
+	tick();
+	stats.ticks++;
+
+#ifdef TM1637_BENCHMARK
+	uint32_t cycles = isrCounter.elapsed();
+	stats.isrCycles += cycles;
+	if (cycles > stats.maxIsrCycles)
+		stats.maxIsrCycles = cycles;
+#endif
+}
+
+void TM1637AsyncBus::startTransfer()
+{
+	position = 0;
+	nextCommand();
+
+	if (current != stateIdle)
+		PIT_StartTimer(PIT, pitChannel);
+}
+
+void TM1637AsyncBus::nextCommand()
+{
+	for (;;) {
+		const tm1637_Transfer &transfer = queue[tail];
+
+		while (position < transfer.size) {
+			remaining = transfer.data[position++];
+			if (remaining != 0) {
+				bit = 0;
+				current = stateStart;
+				return;
+			}
+		}
+
+		// Transferência concluída; segue para a próxima da fila
+		tail = (tail + 1) & (TM1637_ASYNC_QUEUE_DEPTH - 1);
+		position = 0;
+		if (tail == head)
+			break;
+	}
+
+	current = stateIdle;
+	PIT_StopTimer(PIT, pitChannel);
+	exec();
+}
+
+void TM1637AsyncBus::tick()
+{
+	switch (current) {
+	case stateStart:
+		// DIO desce com o clock alto
+		m_pinDIO.setPortMode(gpio_output);
+		current = stateBitLow;
+		break;
+
+	case stateBitLow:
+		m_pinClk.setPortMode(gpio_output);
+		current = stateBitData;
+		break;
+
+	case stateBitData:
+		// DIO só muda um tick depois da descida do clock
+		if ((queue[tail].data[position] >> bit) & 0x01)
+			m_pinDIO.setPortMode(gpio_input);
+		else
+			m_pinDIO.setPortMode(gpio_output);
+		current = stateBitHigh;
+		break;
+
+	case stateBitHigh:
+		m_pinClk.setPortMode(gpio_input);
+		current = (++bit < 8) ? stateBitLow : stateAckLow;
+		break;
+
+	case stateAckLow:
+		m_pinClk.setPortMode(gpio_output);
+		current = stateAckRelease;
+		break;
+
+	case stateAckRelease:
+		m_pinDIO.setPortMode(gpio_input);
+		current = stateAckHigh;
+		break;
+
+	case stateAckHigh:
+		m_pinClk.setPortMode(gpio_input);
+		current = stateAckSample;
+		break;
+
+	case stateAckSample:
+		if (m_pinDIO.readBit())
+			stats.nacks++;
+		// O TM1637 solta DIO na descida do nono clock; a linha volta a ser
+		// dirigida em nível baixo só depois, com o clock já baixo
+		m_pinClk.setPortMode(gpio_output);
+		current = (--remaining != 0) ? stateBitData : stateStopDrive;
+		position++;
+		bit = 0;
+		break;
+
+	case stateStopDrive:
+		m_pinDIO.setPortMode(gpio_output);
+		current = stateStopClk;
+		break;
+
+	case stateStopClk:
+		m_pinClk.setPortMode(gpio_input);
+		current = stateStopDio;
+		break;
+
+	case stateStopDio:
+		// DIO sobe com o clock alto
+		m_pinDIO.setPortMode(gpio_input);
+		nextCommand();
+		break;
+
+	case stateIdle:
+		break;
+	}
+}
@@ -0,0 +1,161 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Transmissão assíncrona para o TM1637 por interrupção do PIT.
+ *
+ * @file        TM1637AsyncBus.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637ASYNCBUS__
+#define __TM1637ASYNCBUS__
+
+#include <inttypes.h>
+#include "fsl_pit.h"
+#include "TM1637Pit.h"
+#include "mkl_DevGPIO.h"
+#include "Callback.h"
+#include "TM1637Bus.h"
+
+// Número de transferências na fila (potência de 2)
+#define TM1637_ASYNC_QUEUE_DEPTH 4
+
+// Ticks do PIT por bit: CLK desce, DIO muda e CLK sobe em ticks separados
+#define TM1637_ASYNC_STEPS_PER_BIT 3
+
+/*
+ * Mínimo de ciclos do núcleo entre dois ticks. Abaixo disso a interrupção não
+ * termina antes do tick seguinte e o PIT perde eventos; a 48 MHz o limite
+ * admite 100 kHz (160 ciclos por tick) e rejeita 250 kHz (64 ciclos). O pior
+ * caso real aparece em maxIsrCycles com TM1637_BENCHMARK.
+ */
+#ifndef TM1637_ASYNC_MIN_TICK_CYCLES
+#define TM1637_ASYNC_MIN_TICK_CYCLES 128
+#endif
+
+/*!
+ * Estatísticas do barramento assíncrono
+ *
+ * Os ciclos de interrupção só são medidos quando TM1637_BENCHMARK é definido.
+ */
+struct tm1637_AsyncStats {
+	uint32_t ticks;			// Interrupções do PIT atendidas
+	uint32_t isrCycles;		// Ciclos gastos no corpo da interrupção
+	uint32_t maxIsrCycles;	// Pior caso de um único tick
+	uint32_t nacks;			// Bytes sem ACK do TM1637
+};
+
+/*!
+ *  @class    TM1637AsyncBus
+ *
+ *  @brief    Barramento do TM1637 que transmite por uma máquina de estados no PIT.
+ *
+ *  @details  Cada interrupção do canal do PIT executa um terço do período de
+ *            bit, de modo que o laço principal fica livre durante a
+ *            transmissão. DIO só muda no tick seguinte à descida de CLK, o
+ *            que garante o tempo de hold do TM1637 após cada borda. Ao
+ *            esvaziar a fila, a função anexada com attach() é executada no
+ *            contexto da interrupção; isBusy() pode ser consultado como flag.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              TM1637AsyncBus asyncBus(clk, dio);
+ *              if (!asyncBus.begin(freq100kHz))
+ *                  // frequência alta demais para a interrupção
+ *              display.attachBus(&asyncBus);
+ *              display.write(42, first);	// retorna sem aguardar o barramento
+ */
+class TM1637AsyncBus : public TM1637Bus, public TM1637PitHandler, public Callback {
+
+public:
+	TM1637AsyncBus(mkl_DevGPIO pinClk, mkl_DevGPIO pinDIO, pit_chnl_t channel = kPIT_Chnl_0);
+
+/*!
+ * Configura o canal do PIT para a frequência de barramento pedida
+ *
+ * Cada tick corresponde a um terço do período de bit, contado no clock de
+ * barramento. Frequências em que um tick tem menos de
+ * TM1637_ASYNC_MIN_TICK_CYCLES ciclos do núcleo são rejeitadas.
+ *
+ * @param frequency A frequência alvo do clock do TM1637
+ * @return false se a interrupção não cabe em um tick nessa frequência
+ */
+	bool begin(busFrequency frequency = freq100kHz);
+
+	bool submit(const tm1637_Transfer &transfer);
+
+	bool isBusy() const;
+
+/*!
+ * Retorna as estatísticas acumuladas desde a última chamada de resetStats()
+ */
+	tm1637_AsyncStats getStats() const;
+
+	void resetStats();
+
+/*!
+ * Trata a interrupção do canal; chamado por PIT_IRQHandler via tm1637_attachPit()
+ */
+	void handleInterrupt();
+
+protected:
+	enum state : uint8_t {
+		stateIdle,
+		stateStart,
+		stateBitLow,
+		stateBitData,
+		stateBitHigh,
+		stateAckLow,
+		stateAckRelease,
+		stateAckHigh,
+		stateAckSample,
+		stateStopDrive,
+		stateStopClk,
+		stateStopDio
+	};
+
+	void tick();
+	void nextCommand();
+	void startTransfer();
+
+private:
+	mkl_DevGPIO m_pinClk;
+	mkl_DevGPIO m_pinDIO;
+	pit_chnl_t pitChannel;
+
+/*!
+ * Fila de transferências: head é escrito pelo laço principal e tail pela
+ * interrupção
+ */
+	tm1637_Transfer queue[TM1637_ASYNC_QUEUE_DEPTH];
+	volatile uint8_t head = 0;
+	volatile uint8_t tail = 0;
+
+/*!
+ * Estado da transferência em andamento
+ */
+	volatile state current = stateIdle;
+	uint8_t position = 0;
+	uint8_t remaining = 0;
+	uint8_t bit = 0;
+
+	tm1637_AsyncStats stats = { 0, 0, 0, 0 };
+};
+
+#endif // __TM1637ASYNCBUS__
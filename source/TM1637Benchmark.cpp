@@ -0,0 +1,354 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Medições de desempenho do periférico TM1637 na MKL25Z.
+ *
+ * @file        TM1637Benchmark.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637Benchmark.h"
+#include "mkl_CycleCounter.h"
+#include "system_MKL25Z4.h"
+
+/*
+ * Referência em float do benchmark de ponto fixo: escala, arredonda e extrai
+ * cada dígito por divisão em float, como "%.2f" faria. O printf da newlib nano
+ * não formata float sem -u _printf_float, que a aplicação não usa.
+ */
+static void floatText(float reading, char text[])
+{
+	char reversed[12];
+	uint8_t count = 0;
+	uint8_t n = 0;
+
+	if (reading < 0.0f) {
+		text[n++] = '-';
+		reading = -reading;
+	}
+
+	float scaled = reading * 100.0f + 0.5f;
+
+	// Duas casas, o ponto e ao menos um dígito inteiro
+	do {
+		float next = (float)(uint32_t)(scaled / 10.0f);
+		reversed[count++] = '0' + (uint8_t)(scaled - next * 10.0f);
+		scaled = next;
+		if (count == 2)
+			reversed[count++] = '.';
+	} while (scaled >= 1.0f || count < 4);
+
+	while (count != 0)
+		text[n++] = reversed[--count];
+	text[n] = '\0';
+}
+
+tm1637_FrameRate TM1637Benchmark::frameRate(TM1637Core &display, busFrequency frequency,
+		uint16_t frames)
+{
+	tm1637_FrameRate result = { 0, 0 };
+	mkl_CycleCounter counter;
+	uint32_t total = 0;
+
+	display.setBusFrequency(frequency);
+	display.calibrateTiming();
+
+	// Cada quadro é medido isoladamente para não estourar os 24 bits do SysTick
+	for (uint16_t i = 0; i < frames; i++) {
+		counter.start();
+		display.writeHexadecimal(i & 0x0f, first);
+		display.writeHexadecimal(i & 0x0f, second);
+		display.writeHexadecimal(i & 0x0f, third);
+		display.writeHexadecimal(i & 0x0f, fourth);
+		total += counter.elapsed();
+	}
+
+	if (frames != 0 && total != 0) {
+		result.cyclesPerFrame = total / frames;
+		result.framesPerSecond = SystemCoreClock / result.cyclesPerFrame;
+	}
+
+	return result;
+}
+
+tm1637_RefreshComparison TM1637Benchmark::refreshCost(TM1637Core &display, uint16_t frames)
+{
+	tm1637_RefreshComparison result = { { 0, 0, 0 }, { 0, 0, 0 } };
+	mkl_CycleCounter counter;
+	uint32_t perDigitCycles = 0;
+	uint32_t burstCycles = 0;
+
+	if (frames == 0)
+		return result;
+
+	display.setLength(one);
+	display.resetBusStats();
+	for (uint16_t i = 0; i < frames; i++) {
+		counter.start();
+		display.writeHexadecimal(i & 0x0f, first);
+		display.writeHexadecimal(i & 0x0f, second);
+		display.writeHexadecimal(i & 0x0f, third);
+		display.writeHexadecimal(i & 0x0f, fourth);
+		perDigitCycles += counter.elapsed();
+	}
+	tm1637_BusStats stats = display.getBusStats();
+	result.perDigit.cycles = perDigitCycles / frames;
+	result.perDigit.bytes = stats.bytes / frames;
+	result.perDigit.transactions = stats.transactions / frames;
+
+	display.resetBusStats();
+	for (uint16_t i = 0; i < frames; i++) {
+		uint8_t values[] = { (uint8_t)(i & 0x0f), (uint8_t)(i & 0x0f),
+				(uint8_t)(i & 0x0f), (uint8_t)(i & 0x0f) };
+		counter.start();
+		display.writeDigits(values);
+		burstCycles += counter.elapsed();
+	}
+	stats = display.getBusStats();
+	result.burst.cycles = burstCycles / frames;
+	result.burst.bytes = stats.bytes / frames;
+	result.burst.transactions = stats.transactions / frames;
+
+	return result;
+}
+
+/*!
+ * Conta as iterações do laço principal durante a janela; com @ref display, um
+ * novo quadro é enviado sempre que o barramento fica livre
+ */
+static uint32_t mainLoopIterations(TM1637Core *display, TM1637AsyncBus &bus,
+		uint32_t windowCycles)
+{
+	mkl_CycleCounter counter;
+	uint32_t iterations = 0;
+	uint8_t value = 0;
+
+	counter.start();
+	while (counter.elapsed() < windowCycles) {
+		if (!bus.isBusy() && display != nullptr) {
+			uint8_t values[] = { value, value, value, value };
+			display->writeDigits(values);
+			value = (value + 1) & 0x0f;
+		}
+		iterations++;
+	}
+
+	return iterations;
+}
+
+tm1637_AsyncLoad TM1637Benchmark::asyncLoad(TM1637Core &display, TM1637AsyncBus &bus,
+		uint32_t windowCycles)
+{
+	tm1637_AsyncLoad result = { 0, 0, 0, 0 };
+
+	uint32_t idleIterations = mainLoopIterations(nullptr, bus, windowCycles);
+
+	display.attachBus(&bus);
+	bus.resetStats();
+	uint32_t busyIterations = mainLoopIterations(&display, bus, windowCycles);
+	tm1637_AsyncStats stats = bus.getStats();
+
+	while (bus.isBusy()) {}
+	display.attachBus(nullptr);
+
+	result.ticks = stats.ticks;
+	result.maxTickCycles = stats.maxIsrCycles;
+	if (stats.ticks != 0)
+		result.cyclesPerTick = stats.isrCycles / stats.ticks;
+	if (idleIterations > busyIterations)
+		result.cpuSharePercent = (idleIterations - busyIterations) * 100 / idleIterations;
+
+	return result;
+}
+
+tm1637_PathCost TM1637Benchmark::pathCost(TM1637Display &display, uint16_t samples)
+{
+	tm1637_PathCost result = { 0, 0, 0 };
+	mkl_CycleCounter counter;
+	uint32_t toggleCycles = 0;
+	uint32_t writeByteCycles = 0;
+
+	// Com o DIO liberado, pulsos isolados no clock não formam um comando
+	for (uint16_t i = 0; i < samples; i++) {
+		counter.start();
+		display.m_pinClk.setPortMode(gpio_output);
+		display.m_pinClk.setPortMode(gpio_input);
+		toggleCycles += counter.elapsed();
+	}
+
+	uint32_t halfBitLoops = display.timing.halfBitLoops;
+	uint32_t holdLoops = display.timing.holdLoops;
+
+	for (uint16_t i = 0; i < samples; i++) {
+		display.start();
+		display.timing.halfBitLoops = 0;
+		display.timing.holdLoops = 0;
+		counter.start();
+		display.writeByte(0x40);	// Modo de dados com auto incremento
+		writeByteCycles += counter.elapsed();
+		display.timing.halfBitLoops = halfBitLoops;
+		display.timing.holdLoops = holdLoops;
+		display.stop();
+	}
+
+	result.toggleCycles = toggleCycles / (2 * samples);
+	result.writeByteCycles = writeByteCycles / samples;
+	if (result.toggleCycles != 0)
+		result.togglesPerSecond = SystemCoreClock / result.toggleCycles;
+
+	return result;
+}
+
+/*!
+ * Laço original de showNumberBaseEx(), com % e / por dígito, como referência
+ */
+static void divisionFormat(TM1637Core &display, int8_t base, uint16_t num,
+		leadingZero leading_zero, numLength length, uint8_t digits[])
+{
+	bool negative = false;
+	if (base < 0) {
+		base = -base;
+		negative = true;
+	}
+
+	if (num == 0 && !leading_zero) {
+		for (uint8_t i = 0; i < (length - 1); i++)
+			digits[i] = 0;
+		digits[length - 1] = display.encodeDigit(0);
+		return;
+	}
+
+	for (int i = length - 1; i >= 0; --i) {
+		uint8_t digit = num % base;
+
+		if (digit == 0 && num == 0 && leading_zero == false)
+			digits[i] = 0;
+		else
+			digits[i] = display.encodeDigit(digit);
+
+		if (digit == 0 && num == 0 && negative) {
+			digits[i] = 0b01000000;
+			negative = false;
+		}
+
+		num /= base;
+	}
+}
+
+tm1637_FormatCost TM1637Benchmark::baseCost(TM1637Core &display, int8_t base, uint16_t samples)
+{
+	tm1637_FormatCost result = { 0, 0 };
+	mkl_CycleCounter counter;
+	uint32_t divisionCycles = 0;
+	uint32_t formatterCycles = 0;
+	uint8_t digits[4];
+
+	// Valores espalhados pela faixa de 16 bits, para não favorecer números curtos
+	for (uint16_t i = 0; i < samples; i++) {
+		uint16_t num = i * 2557;
+
+		counter.start();
+		divisionFormat(display, base, num, show, four, digits);
+		divisionCycles += counter.elapsed();
+
+		counter.start();
+		display.formatNumber(base, num, hideDots, show, four, digits);
+		formatterCycles += counter.elapsed();
+	}
+
+	result.divisionCycles = divisionCycles / samples;
+	result.formatterCycles = formatterCycles / samples;
+
+	return result;
+}
+
+tm1637_FormatComparison TM1637Benchmark::formatCost(TM1637Core &display, uint16_t samples)
+{
+	tm1637_FormatComparison result = { { 0, 0 }, { 0, 0 } };
+
+	if (samples == 0)
+		return result;
+
+	result.decimal = baseCost(display, 10, samples);
+	result.hexadecimal = baseCost(display, 16, samples);
+
+	return result;
+}
+
+tm1637_FixedCost TM1637Benchmark::fixedCost(TM1637Core &display, uint16_t samples)
+{
+	tm1637_FixedCost result = { 0, 0 };
+	mkl_CycleCounter counter;
+	uint32_t floatCycles = 0;
+	uint32_t fixedCycles = 0;
+	uint8_t digits[TM1637_MAX_DIGITS];
+	char text[16];
+
+	if (samples == 0)
+		return result;
+
+	// Leituras de -50,00 a cerca de +50,00, incluindo as que perdem casas
+	for (uint16_t i = 0; i < samples; i++) {
+		int32_t value = (int32_t)i * 157 - 5000;
+
+		counter.start();
+		floatText((float)value / 100.0f, text);
+		tm1637_encodeText(text, digits, four);
+		floatCycles += counter.elapsed();
+
+		counter.start();
+		display.formatFixed(value, 2, four, digits);
+		fixedCycles += counter.elapsed();
+	}
+
+	result.floatCycles = floatCycles / samples;
+	result.fixedCycles = fixedCycles / samples;
+
+	return result;
+}
+
+tm1637_AccessComparison TM1637Benchmark::accessCost(TM1637Display &display, gpio_Pin pinClk,
+		gpio_Pin pinDIO, uint16_t samples)
+{
+	tm1637_AccessComparison result = { { 0, 0, 0 }, { 0, 0, 0 } };
+	mkl_DevGPIO clk = display.m_pinClk;
+	mkl_DevGPIO dio = display.m_pinDIO;
+
+	if (samples == 0)
+		return result;
+
+	display.m_pinClk = mkl_DevGPIO(pinClk, gpio_bridge);
+	display.m_pinDIO = mkl_DevGPIO(pinDIO, gpio_bridge);
+	display.calibrateTiming();
+	result.bridge = pathCost(display, samples);
+
+	display.m_pinClk = mkl_DevGPIO(pinClk, gpio_fast);
+	display.m_pinDIO = mkl_DevGPIO(pinDIO, gpio_fast);
+	display.calibrateTiming();
+	result.fast = pathCost(display, samples);
+
+	// Os pinos originais podem usar outro caminho; a temporização é refeita
+	// no próximo comando, e o modo de dados enviado aqui invalida o cache
+	display.m_pinClk = clk;
+	display.m_pinDIO = dio;
+	display.timing.calibratedClock = 0;
+	display.lastDataCommand = 0;
+
+	return result;
+}
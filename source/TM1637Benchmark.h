@@ -0,0 +1,214 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Medições de desempenho do periférico TM1637 na MKL25Z.
+ *
+ * @file        TM1637Benchmark.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637BENCHMARK__
+#define __TM1637BENCHMARK__
+
+#include <inttypes.h>
+#include "TM1637Display.h"
+#include "TM1637AsyncBus.h"
+
+/*!
+ * Resultado da medição da taxa de quadros
+ */
+struct tm1637_FrameRate {
+	uint32_t cyclesPerFrame;
+	uint32_t framesPerSecond;
+};
+
+/*!
+ * Custo de uma atualização dos quatro dígitos
+ */
+struct tm1637_RefreshCost {
+	uint32_t cycles;		// Ciclos do núcleo por atualização
+	uint32_t bytes;			// Bytes no barramento por atualização
+	uint32_t transactions;	// Transações start/stop por atualização
+};
+
+/*!
+ * Comparação entre a atualização por dígito e a atualização em rajada
+ */
+struct tm1637_RefreshComparison {
+	tm1637_RefreshCost perDigit;
+	tm1637_RefreshCost burst;
+};
+
+/*!
+ * Carga do barramento assíncrono sobre o núcleo
+ */
+struct tm1637_AsyncLoad {
+	uint32_t ticks;				// Interrupções do PIT na janela medida
+	uint32_t cyclesPerTick;		// Custo médio do corpo da interrupção
+	uint32_t maxTickCycles;		// Pior caso de um tick
+	uint32_t cpuSharePercent;	// Fração do núcleo gasta com o tráfego do display
+};
+
+/*!
+ * Custo das operações de pino por um caminho de acesso ao GPIO
+ */
+struct tm1637_PathCost {
+	uint32_t toggleCycles;		// Ciclos por troca de direção do pino
+	uint32_t togglesPerSecond;	// Taxa de trocas alcançável no clock atual
+	uint32_t writeByteCycles;	// Ciclos de writeByte() sem os atrasos de bit
+};
+
+/*!
+ * Comparação entre o GPIO na ponte de periféricos e o FGPIO na IOPORT
+ */
+struct tm1637_AccessComparison {
+	tm1637_PathCost bridge;
+	tm1637_PathCost fast;
+};
+
+/*!
+ * Custo da conversão de um número nos segmentos dos quatro dígitos
+ */
+struct tm1637_FormatCost {
+	uint32_t divisionCycles;	// Laço com % e / (divisão em software da libgcc)
+	uint32_t formatterCycles;	// TM1637Core::formatNumber()
+};
+
+/*!
+ * Custo da conversão nas bases usadas pelo display
+ */
+struct tm1637_FormatComparison {
+	tm1637_FormatCost decimal;
+	tm1637_FormatCost hexadecimal;
+};
+
+/*!
+ * Custo da conversão de uma leitura com duas casas decimais nos segmentos
+ */
+struct tm1637_FixedCost {
+	uint32_t floatCycles;	// float, dígitos por divisão em float e conversão pela fonte
+	uint32_t fixedCycles;	// TM1637Core::formatFixed()
+};
+
+/*!
+ *  @class    TM1637Benchmark
+ *
+ *  @brief    Rotinas de medição de desempenho do driver do TM1637.
+ *
+ *  @details  Os tempos são medidos em ciclos do núcleo com mkl_CycleCounter
+ *            (SysTick) e os resultados ficam nas estruturas retornadas, para
+ *            inspeção pelo depurador.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              tm1637_FrameRate rate = TM1637Benchmark::frameRate(display, freq250kHz, 16);
+ */
+class TM1637Benchmark {
+
+public:
+/*!
+ * Mede a taxa de quadros alcançada em uma frequência de barramento
+ *
+ * Um quadro é a atualização dos quatro dígitos feita por main.cpp, com uma
+ * chamada de writeHexadecimal() por dígito.
+ *
+ * @param display O display a ser medido
+ * @param frequency A frequência alvo do barramento
+ * @param frames O número de quadros a serem enviados
+ */
+	static tm1637_FrameRate frameRate(TM1637Core &display, busFrequency frequency,
+			uint16_t frames);
+
+/*!
+ * Compara a atualização por dígito com a atualização em rajada
+ *
+ * O caminho por dígito faz quatro chamadas de writeHexadecimal() com um dígito
+ * cada; o caminho em rajada formata os quatro dígitos e chama writeDigits().
+ *
+ * @param display O display a ser medido
+ * @param frames O número de atualizações medidas em cada caminho
+ */
+	static tm1637_RefreshComparison refreshCost(TM1637Core &display, uint16_t frames);
+
+/*!
+ * Mede o custo do barramento assíncrono sobre o laço principal
+ *
+ * O laço principal conta iterações durante uma janela sem tráfego e durante uma
+ * janela em que um novo quadro é enviado sempre que o barramento fica livre. A
+ * perda de iterações inclui a entrada e saída das interrupções, que o custo
+ * medido dentro do tratador não enxerga.
+ *
+ * @param display O display a ser medido; o barramento é desanexado ao final
+ * @param bus O barramento assíncrono já configurado com begin()
+ * @param windowCycles A duração de cada janela, menor que 2^24 ciclos
+ */
+	static tm1637_AsyncLoad asyncLoad(TM1637Core &display, TM1637AsyncBus &bus,
+			uint32_t windowCycles);
+
+/*!
+ * Compara o custo das operações de pino pelo GPIO e pelo FGPIO
+ *
+ * Os pinos do display são substituídos temporariamente por objetos criados com
+ * cada caminho de acesso. writeByte() é medido com os atrasos de bit zerados,
+ * de modo que o resultado reflete só o custo dos acessos aos registradores; o
+ * byte enviado é o comando de modo de dados, reenviado na próxima escrita.
+ *
+ * As trocas de direção diferem nos dois caminhos: pela ponte são uma escrita
+ * indivisível do BME; pelo FGPIO são leitura e escrita do PDDR em um ciclo
+ * cada, sem a proteção contra interrupções (veja gpio_AccessPath).
+ *
+ * @param display O display a ser medido
+ * @param pinClk O pino de clock do display
+ * @param pinDIO O pino de dados do display
+ * @param samples O número de repetições de cada medição
+ */
+	static tm1637_AccessComparison accessCost(TM1637Display &display, gpio_Pin pinClk,
+			gpio_Pin pinDIO, uint16_t samples);
+
+/*!
+ * Compara o formatador sem divisão com o laço de divisões que o precedia
+ *
+ * Cada amostra converte um número diferente em quatro dígitos, sem enviar nada
+ * ao display. O valor retornado é a média de ciclos por conversão.
+ *
+ * @param display O display cujo formatador é medido
+ * @param samples O número de conversões em cada caminho
+ */
+	static tm1637_FormatComparison formatCost(TM1637Core &display, uint16_t samples);
+
+/*!
+ * Compara a conversão em ponto fixo com o caminho por float
+ *
+ * Cada amostra converte uma leitura diferente, em centésimos, nos segmentos
+ * de quatro dígitos, sem enviar nada ao display. O caminho de referência
+ * divide a leitura por 100 em float e extrai cada dígito com divisões em
+ * float, em vez de snprintf("%.2f"), que a newlib nano não formata sem
+ * -u _printf_float.
+ *
+ * @param display O display cujo formatador é medido
+ * @param samples O número de conversões em cada caminho
+ */
+	static tm1637_FixedCost fixedCost(TM1637Core &display, uint16_t samples);
+
+protected:
+	static tm1637_PathCost pathCost(TM1637Display &display, uint16_t samples);
+	static tm1637_FormatCost baseCost(TM1637Core &display, int8_t base, uint16_t samples);
+};
+
+#endif // __TM1637BENCHMARK__
@@ -0,0 +1,52 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Protocolo de dois fios do TM1637 por bit-bang.
+ *
+ * @file        TM1637BitBang.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637BitBang.h"
+
+static uint32_t nsToCycles(uint32_t ns, uint32_t coreClock)
+{
+	return (ns * (coreClock / 1000) + 999999) / 1000000;
+}
+
+static uint32_t cyclesToLoops(uint32_t cycles, uint32_t stepCycles)
+{
+	if (cycles <= stepCycles)
+		return 0;
+	return (cycles - stepCycles + TM1637_LOOP_CYCLES - 1) / TM1637_LOOP_CYCLES;
+}
+
+void tm1637_setTiming(tm1637_Timing &timing, uint32_t stepCycles)
+{
+	uint32_t coreClock = SystemCoreClock;
+
+	uint32_t halfBitCycles = coreClock / (2 * timing.frequency);
+	uint32_t minPulseCycles = nsToCycles(TM1637_MIN_PULSE_NS, coreClock);
+	if (halfBitCycles < minPulseCycles)
+		halfBitCycles = minPulseCycles;
+
+	timing.halfBitLoops = cyclesToLoops(halfBitCycles, stepCycles);
+	timing.holdLoops = cyclesToLoops(nsToCycles(TM1637_HOLD_NS, coreClock), stepCycles);
+	timing.calibratedClock = coreClock;
+}
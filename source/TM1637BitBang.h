@@ -0,0 +1,224 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Protocolo de dois fios do TM1637 por bit-bang.
+ *
+ * @file        TM1637BitBang.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637BITBANG__
+#define __TM1637BITBANG__
+
+#include <inttypes.h>
+#include "mkl_DevGPIO.h"
+#include "mkl_CycleCounter.h"
+#include "system_MKL25Z4.h"
+#include "TM1637Bus.h"
+
+// Temporização mínima do TM1637 (datasheet, PWCLK e tHOLD)
+#define TM1637_MIN_PULSE_NS 400
+#define TM1637_HOLD_NS      100
+
+// Ciclos gastos por iteração do laço de atraso (SUBS + BNE tomado)
+#define TM1637_LOOP_CYCLES  3
+
+/*!
+ * Temporização calibrada do barramento
+ */
+struct tm1637_Timing {
+	busFrequency frequency;		// Frequência alvo do clock
+	uint32_t halfBitLoops;		// Iterações de atraso por meio período de bit
+	uint32_t holdLoops;			// Iterações de atraso de hold do dado
+	uint32_t calibratedClock;	// SystemCoreClock da última calibração (0 = nenhuma)
+};
+
+/*!
+ * Laço de atraso em assembly, com custo fixo de TM1637_LOOP_CYCLES ciclos por
+ * iteração independente do nível de otimização
+ */
+static inline void tm1637_busyWait(uint32_t loops)
+{
+	if (loops != 0)
+		__asm volatile ("1: subs %0, %0, #1 \n\t bne 1b" : "+l" (loops) : : "cc");
+}
+
+/*!
+ * Calcula os atrasos de meio bit e de hold para o clock atual do núcleo
+ *
+ * @param timing A temporização, com a frequência alvo já definida
+ * @param stepCycles O custo medido de uma operação de pino seguida de um atraso vazio
+ */
+void tm1637_setTiming(tm1637_Timing &timing, uint32_t stepCycles);
+
+/*
+ * As funções abaixo recebem os pinos como parâmetro de template, de modo que
+ * servem tanto para mkl_DevGPIO, com endereços em ponteiros, quanto para
+ * mkl_DevGPIOPin, com endereços constantes e sem indireção.
+ */
+
+/*!
+ * Mede o custo de um passo do barramento e recalcula a temporização
+ *
+ * O DIO está liberado entre comandos, então reescrever a sua direção não gera
+ * transição no barramento.
+ */
+template<class Dio>
+void tm1637_calibrate(Dio &dio, tm1637_Timing &timing)
+{
+	mkl_CycleCounter counter;
+
+	timing.halfBitLoops = 0;
+	timing.holdLoops = 0;
+	counter.start();
+	for (uint8_t i = 0; i < 8; i++) {
+		dio.setPortMode(gpio_input);
+		tm1637_busyWait(timing.halfBitLoops);
+	}
+
+	tm1637_setTiming(timing, counter.elapsed() / 8);
+}
+
+template<class Clk, class Dio>
+void tm1637_start(Clk &clk, Dio &dio, const tm1637_Timing &timing)
+{
+	dio.setPortMode(gpio_output);
+	tm1637_busyWait(timing.halfBitLoops);
+}
+
+template<class Clk, class Dio>
+void tm1637_stop(Clk &clk, Dio &dio, const tm1637_Timing &timing)
+{
+	dio.setPortMode(gpio_output);
+	tm1637_busyWait(timing.halfBitLoops);
+	clk.setPortMode(gpio_input);
+	tm1637_busyWait(timing.halfBitLoops);
+	dio.setPortMode(gpio_input);
+	tm1637_busyWait(timing.halfBitLoops);
+}
+
+/*!
+ * Envia um byte, LSB primeiro, e retorna o nível do DIO no bit de ACK
+ */
+template<class Clk, class Dio>
+bool tm1637_writeByte(Clk &clk, Dio &dio, const tm1637_Timing &timing, uint8_t b)
+{
+	uint8_t data = b;
+
+	// Cada bit ocupa dois meios períodos: clock baixo (dado muda após o hold)
+	// e clock alto (dado amostrado pelo TM1637)
+	for(uint8_t i = 0; i < 8; i++) {
+
+		clk.setPortMode(gpio_output);
+		tm1637_busyWait(timing.holdLoops);
+
+		if (data & 0x01)
+			dio.setPortMode(gpio_input);
+		else
+			dio.setPortMode(gpio_output);
+
+		tm1637_busyWait(timing.halfBitLoops);
+
+		clk.setPortMode(gpio_input);
+		tm1637_busyWait(timing.halfBitLoops);
+		data = data >> 1;
+	}
+
+	clk.setPortMode(gpio_output);
+	tm1637_busyWait(timing.holdLoops);
+	dio.setPortMode(gpio_input);
+	tm1637_busyWait(timing.halfBitLoops);
+
+	clk.setPortMode(gpio_input);
+	tm1637_busyWait(timing.halfBitLoops);
+	uint8_t ack = dio.readBit();
+	if (ack == 0) {
+		dio.setPortMode(gpio_output);
+	}
+
+	clk.setPortMode(gpio_output);
+	tm1637_busyWait(timing.holdLoops);
+
+	return ack;
+}
+
+/*!
+ * Lê um byte do TM1637, LSB primeiro, e gera o clock do ACK
+ *
+ * O TM1637 muda o dado na borda de descida do clock; a leitura é feita com o
+ * clock alto.
+ */
+template<class Clk, class Dio>
+uint8_t tm1637_readByte(Clk &clk, Dio &dio, const tm1637_Timing &timing)
+{
+	uint8_t data = 0;
+
+	dio.setPortMode(gpio_input);
+
+	for (uint8_t i = 0; i < 8; i++) {
+		clk.setPortMode(gpio_output);
+		tm1637_busyWait(timing.halfBitLoops);
+		clk.setPortMode(gpio_input);
+		tm1637_busyWait(timing.halfBitLoops);
+
+		data >>= 1;
+		if (dio.readBit())
+			data |= 0x80;
+	}
+
+	clk.setPortMode(gpio_output);
+	tm1637_busyWait(timing.halfBitLoops);
+	clk.setPortMode(gpio_input);
+	tm1637_busyWait(timing.halfBitLoops);
+	clk.setPortMode(gpio_output);
+	tm1637_busyWait(timing.holdLoops);
+
+	return data;
+}
+
+/*!
+ * Envia um comando de leitura e retorna o byte lido, em um par start/stop
+ */
+template<class Clk, class Dio>
+uint8_t tm1637_read(Clk &clk, Dio &dio, const tm1637_Timing &timing, uint8_t command)
+{
+	tm1637_start(clk, dio, timing);
+	tm1637_writeByte(clk, dio, timing, command);
+	uint8_t data = tm1637_readByte(clk, dio, timing);
+	tm1637_stop(clk, dio, timing);
+
+	return data;
+}
+
+/*!
+ * Envia todos os comandos de uma transferência, um par start/stop por comando
+ */
+template<class Clk, class Dio>
+void tm1637_send(Clk &clk, Dio &dio, const tm1637_Timing &timing,
+		const tm1637_Transfer &transfer)
+{
+	for (uint8_t i = 0; i < transfer.size; i += transfer.data[i] + 1) {
+		tm1637_start(clk, dio, timing);
+		for (uint8_t k = 1; k <= transfer.data[i]; k++)
+			tm1637_writeByte(clk, dio, timing, transfer.data[i + k]);
+		tm1637_stop(clk, dio, timing);
+	}
+}
+
+#endif // __TM1637BITBANG__
@@ -0,0 +1,103 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Interface dos barramentos de transmissão do TM1637.
+ *
+ * @file        TM1637Bus.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637BUS__
+#define __TM1637BUS__
+
+#include <inttypes.h>
+
+// Tamanho máximo, em bytes, de uma transferência codificada
+#define TM1637_TRANSFER_SIZE 32
+
+// Frequência alvo do clock do barramento do TM1637
+enum busFrequency : uint32_t {
+	freq100kHz = 100000,
+	freq250kHz = 250000,	// Máximo especificado no datasheet
+	freq500kHz = 500000		// Acima do especificado, depende dos capacitores do módulo
+};
+
+// Contadores de tráfego no barramento
+struct tm1637_BusStats {
+	uint32_t bytes;			// Bytes enviados, incluindo os de comando
+	uint32_t transactions;	// Pares start/stop
+};
+
+/*!
+ * Sequência de comandos a ser enviada ao TM1637
+ *
+ * Cada comando (um par start/stop) é codificado como o seu número de bytes
+ * seguido dos bytes: [n, b0, ..., bn-1][n, ...].
+ */
+struct tm1637_Transfer {
+	uint8_t data[TM1637_TRANSFER_SIZE];
+	uint8_t size;
+	uint8_t command;
+
+	void clear()
+	{
+		size = 0;
+	}
+
+	void beginCommand()
+	{
+		command = size;
+		data[size++] = 0;
+	}
+
+	void append(uint8_t b)
+	{
+		data[size++] = b;
+		data[command]++;
+	}
+};
+
+/*!
+ *  @class    TM1637Bus
+ *
+ *  @brief    Interface de um meio de transmissão para o TM1637Display.
+ *
+ *  @details  O display monta as transferências e as entrega ao barramento
+ *            anexado com TM1637Display::attachBus(). Sem barramento anexado,
+ *            o display transmite por bit-bang bloqueante nos seus próprios pinos.
+ */
+class TM1637Bus {
+
+public:
+/*!
+ * Enfileira uma transferência
+ *
+ * A transferência é copiada, de modo que o chamador pode reutilizá-la.
+ *
+ * @return false se não houver espaço na fila; nada é enfileirado nesse caso
+ */
+	virtual bool submit(const tm1637_Transfer &transfer) = 0;
+
+/*!
+ * Indica se ainda há transferências em andamento ou na fila
+ */
+	virtual bool isBusy() const = 0;
+};
+
+#endif // __TM1637BUS__
@@ -0,0 +1,224 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Brilho com dithering temporal e transições suaves.
+ *
+ * @file        TM1637Dimmer.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637Dimmer.h"
+#include "fsl_clock.h"
+#include "mkl_CycleCounter.h"
+
+static mkl_CycleCounter commandCounter;
+
+/*!
+ * Dimmer associado ao TPM2, para o tratador de interrupção
+ */
+static TM1637Dimmer *tpmInstance = nullptr;
+
+/*
+ * Nível percebido -> (âncora << 4) | fração em dezesseis avos
+ *
+ * As âncoras são o display apagado (0) e os níveis 0 a 7 do hardware (1 a 8),
+ * com ciclo de trabalho de 1, 2, 4, 10, 11, 12, 13 e 14 dezesseis avos. O
+ * brilho alvo é 1/16 da âncora 1 mais (14 - 1/16) * ((nível - 1) / 62)^2,2,
+ * interpolado linearmente entre as âncoras vizinhas.
+ */
+static const uint8_t gammaTable[TM1637_DIMMER_LEVELS] = {
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
+	0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+	0x0B, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18,
+	0x1A, 0x1D, 0x1F, 0x21, 0x22, 0x24, 0x25, 0x27,
+	0x29, 0x2B, 0x2C, 0x2E, 0x30, 0x31, 0x31, 0x32,
+	0x33, 0x34, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+	0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x46,
+	0x4C, 0x53, 0x5A, 0x62, 0x69, 0x70, 0x78, 0x80,
+};
+
+/*
+ * Ordem dos subquadros com os bits invertidos: o subquadro s fica na âncora
+ * mais alta quando subframeOrder[s] < fração
+ */
+static const uint8_t subframeOrder[TM1637_DIMMER_SUBFRAMES] = {
+	0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15
+};
+
+TM1637Dimmer::TM1637Dimmer(TM1637Core &display) : display(display)
+{
+}
+
+void TM1637Dimmer::begin(uint16_t tickHz)
+{
+	tpm_config_t config;
+	uint32_t prescale = kTPM_Prescale_Divide_1;
+
+	tickRate = (tickHz != 0) ? tickHz : 1;
+
+	CLOCK_SetTpmClock(1U);
+	uint32_t clock = CLOCK_GetPllFllSelClkFreq();
+
+	// O MOD tem 16 bits: o menor divisor em que o período cabe nele
+	while (prescale < kTPM_Prescale_Divide_128 && (clock >> prescale) / tickRate > 0x10000)
+		prescale++;
+
+	// Abaixo de clock / 128 / 65536 (cerca de 6 Hz a 48 MHz) nem o maior divisor basta
+	if ((clock >> prescale) / tickRate > 0x10000)
+		tickRate = (clock >> prescale) / 0x10000 + 1;
+
+	TPM_GetDefaultConfig(&config);
+	config.prescale = (tpm_clock_prescale_t)prescale;
+	TPM_Init(TPM2, &config);
+	TPM_SetTimerPeriod(TPM2, (clock >> prescale) / tickRate - 1);
+
+	lastAnchor = 0xFF;
+	tpmInstance = this;
+	TPM_EnableInterrupts(TPM2, kTPM_TimeOverflowInterruptEnable);
+	NVIC_EnableIRQ(TPM2_IRQn);
+	TPM_StartTimer(TPM2, kTPM_SystemClock);
+}
+
+void TM1637Dimmer::end()
+{
+	TPM_StopTimer(TPM2);
+	NVIC_DisableIRQ(TPM2_IRQn);
+	tpmInstance = nullptr;
+}
+
+void TM1637Dimmer::setLevel(uint8_t level)
+{
+	if (level >= TM1637_DIMMER_LEVELS)
+		level = TM1637_DIMMER_LEVELS - 1;
+
+	fading = false;
+	this->level = level << 8;
+}
+
+void TM1637Dimmer::fadeTo(uint8_t level, uint16_t durationMs)
+{
+	if (level >= TM1637_DIMMER_LEVELS)
+		level = TM1637_DIMMER_LEVELS - 1;
+
+	// Uma divisão por transição: passos de um ciclo de dithering cada
+	uint32_t cycles = (uint32_t)durationMs * tickRate / (1000 * TM1637_DIMMER_SUBFRAMES);
+
+	if (cycles == 0) {
+		setLevel(level);
+		return;
+	}
+
+	fading = false;
+	target = level << 8;
+	step = ((int32_t)target - (int32_t)this->level) / (int32_t)cycles;
+	if (step == 0)
+		step = (target > this->level) ? 1 : -1;
+	fading = true;
+}
+
+uint8_t TM1637Dimmer::getLevel() const
+{
+	return level >> 8;
+}
+
+bool TM1637Dimmer::isFading() const
+{
+	return fading;
+}
+
+tm1637_DimmerStats TM1637Dimmer::getStats() const
+{
+	return stats;
+}
+
+void TM1637Dimmer::resetStats()
+{
+	stats.ticks = 0;
+	stats.commands = 0;
+	stats.skipped = 0;
+	stats.commandCycles = 0;
+	stats.maxCommandCycles = 0;
+}
+
+tm1637_DimmerLoad TM1637Dimmer::getLoad() const
+{
+	tm1637_DimmerLoad load = { tickRate, 0, 0, 0, 0 };
+
+	if (stats.ticks == 0)
+		return load;
+
+	load.commandsPerSecond = (uint64_t)stats.commands * tickRate / stats.ticks;
+	load.commandsPerTickPermille = (uint64_t)stats.commands * 1000 / stats.ticks;
+	load.cyclesPerTick = stats.commandCycles / stats.ticks;
+	load.cpuSharePermille = (uint64_t)load.cyclesPerTick * tickRate * 1000 / SystemCoreClock;
+
+	return load;
+}
+
+void TM1637Dimmer::handleInterrupt()
+{
+	TPM_ClearStatusFlags(TPM2, kTPM_TimeOverflowFlag);
+	stats.ticks++;
+
+	if (subframe == 0 && fading) {
+		int32_t next = (int32_t)level + step;
+
+		if ((step > 0 && next >= target) || (step < 0 && next <= target)) {
+			next = target;
+			fading = false;
+		}
+		level = next;
+	}
+
+	uint8_t entry = gammaTable[level >> 8];
+	uint8_t anchor = entry >> 4;
+
+	if (subframeOrder[subframe] < (entry & 0x0F))
+		anchor++;
+	subframe = (subframe + 1) & (TM1637_DIMMER_SUBFRAMES - 1);
+
+	if (anchor == lastAnchor)
+		return;
+
+	if (!display.isIdle()) {
+		stats.skipped++;
+		return;
+	}
+
+	commandCounter.start();
+
+	// Âncora 0 apaga o display; as demais são os níveis 0 a 7 do hardware
+	display.setBrightness((anchor != 0) ? anchor - 1 : 0, anchor != 0);
+	display.updateBrightness();
+	lastAnchor = anchor;
+
+	uint32_t cycles = commandCounter.elapsed();
+	stats.commands++;
+	stats.commandCycles += cycles;
+	if (cycles > stats.maxCommandCycles)
+		stats.maxCommandCycles = cycles;
+}
+
+extern "C" void TPM2_IRQHandler(void)
+{
+	if (tpmInstance != nullptr)
+		tpmInstance->handleInterrupt();
+	else
+		TPM_ClearStatusFlags(TPM2, kTPM_TimeOverflowFlag);
+}
@@ -0,0 +1,158 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Brilho com dithering temporal e transições suaves.
+ *
+ * @file        TM1637Dimmer.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637DIMMER__
+#define __TM1637DIMMER__
+
+#include <inttypes.h>
+#include "fsl_tpm.h"
+#include "TM1637Display.h"
+
+// Níveis de brilho percebido (0 = apagado)
+#define TM1637_DIMMER_LEVELS    64
+
+// Subquadros por ciclo de dithering (potência de 2)
+#define TM1637_DIMMER_SUBFRAMES 16
+
+/*!
+ * Estatísticas do dimmer
+ */
+struct tm1637_DimmerStats {
+	uint32_t ticks;				// Interrupções do TPM atendidas
+	uint32_t commands;			// Comandos de controle enviados
+	uint32_t skipped;			// Trocas adiadas por uma escrita em andamento
+	uint32_t commandCycles;		// Ciclos gastos no envio dos comandos
+	uint32_t maxCommandCycles;	// Pior caso de um único comando
+};
+
+/*!
+ * Carga do dimmer no barramento e no núcleo, calculada a partir das estatísticas
+ */
+struct tm1637_DimmerLoad {
+	uint32_t tickRate;					// Ticks por segundo configurados
+	uint32_t commandsPerSecond;			// Comandos de 1 byte enviados por segundo
+	uint32_t commandsPerTickPermille;	// Comandos por tick, em milésimos
+	uint32_t cyclesPerTick;				// Custo médio de um tick em envio
+	uint32_t cpuSharePermille;			// Fração do núcleo gasta nos envios, em milésimos
+};
+
+/*!
+ *  @class    TM1637Dimmer
+ *
+ *  @brief    Mais níveis de brilho que os 8 do TM1637, por dithering temporal.
+ *
+ *  @details  Cada nível percebido (0 a 63, com curva gama 2,2) corresponde a um
+ *            par de níveis vizinhos do hardware, ou ao display apagado e o
+ *            nível 0, e à fração de subquadros no nível mais alto. O TPM2
+ *            avança um subquadro por tick, em uma ordem com os bits invertidos
+ *            que espalha os subquadros altos pelo ciclo. Só o comando de
+ *            controle de 1 byte é enviado, e apenas quando o nível do hardware
+ *            muda entre dois subquadros.
+ *
+ *            fadeTo() faz uma transição linear nos níveis percebidos, avançada
+ *            uma vez por ciclo de dithering.
+ *
+ *            Enquanto o dimmer está ativo, setBrightness() não deve ser chamado
+ *            pela aplicação.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              TM1637Dimmer dimmer(display);
+ *              dimmer.begin(2000);
+ *              dimmer.fadeTo(63, 500);
+ */
+class TM1637Dimmer {
+
+public:
+	TM1637Dimmer(TM1637Core &display);
+
+/*!
+ * Configura o TPM2 e inicia o dithering
+ *
+ * O clock do TPM é o MCGFLLCLK ou MCGPLLCLK/2, dividido pelo menor divisor em
+ * que o período cabe nos 16 bits do contador.
+ *
+ * @param tickHz Subquadros por segundo; um ciclo completo dura
+ *        TM1637_DIMMER_SUBFRAMES ticks. Valores abaixo do mínimo do TPM (cerca
+ *        de 6 Hz a 48 MHz) são elevados a ele
+ */
+	void begin(uint16_t tickHz = 2000);
+
+	void end();
+
+/*!
+ * Define o nível percebido imediatamente, interrompendo uma transição
+ *
+ * @param level De 0 (apagado) a TM1637_DIMMER_LEVELS - 1
+ */
+	void setLevel(uint8_t level);
+
+/*!
+ * Inicia uma transição linear até o nível pedido
+ *
+ * @param durationMs A duração da transição; 0 equivale a setLevel()
+ */
+	void fadeTo(uint8_t level, uint16_t durationMs);
+
+	uint8_t getLevel() const;
+
+	bool isFading() const;
+
+/*!
+ * Retorna as estatísticas acumuladas desde a última chamada de resetStats()
+ */
+	tm1637_DimmerStats getStats() const;
+
+	void resetStats();
+
+/*!
+ * Calcula a carga no barramento e no núcleo a partir das estatísticas
+ */
+	tm1637_DimmerLoad getLoad() const;
+
+/*!
+ * Avança um subquadro; chamado por TPM2_IRQHandler
+ */
+	void handleInterrupt();
+
+private:
+	TM1637Core &display;
+	uint16_t tickRate = 2000;
+
+/*!
+ * Nível atual e alvo em ponto fixo 8.8, passo por ciclo de dithering
+ */
+	volatile uint16_t level = 0;
+	uint16_t target = 0;
+	int16_t step = 0;
+	volatile bool fading = false;
+
+	uint8_t subframe = 0;
+	uint8_t lastAnchor = 0xFF;
+
+	tm1637_DimmerStats stats = { 0, 0, 0, 0, 0 };
+};
+
+#endif // __TM1637DIMMER__
@@ -52,8 +52,11 @@ extern "C" {
 
 #include <unistd.h>
 #include <TM1637Display.h>
+#include "system_MKL25Z4.h"
 
 #define TM1637_I2C_COMM1    0x40
+#define TM1637_I2C_COMM1_FIXED 0x44
+#define TM1637_I2C_COMM1_READ  0x42
 #define TM1637_I2C_COMM2    0xC0
 #define TM1637_I2C_COMM3    0x80
 
@@ -87,6 +90,17 @@ const uint8_t digitToSegment[] = {
 
 static const uint8_t minusSegments = 0b01000000;
 
+static const uint32_t powersOf10[] = {
+	1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1
+};
+
+TM1637Core::TM1637Core()
+{
+	dotsMask = hideDots;
+	digitLength = one;
+	digitMode = hide;
+}
+
 TM1637Display::TM1637Display(mkl_DevGPIO pinClk, mkl_DevGPIO pinDIO)
 {
 	// Seta os pins a serem utilizados pelo periférico
@@ -97,120 +111,447 @@ TM1637Display::TM1637Display(mkl_DevGPIO pinClk, mkl_DevGPIO pinDIO)
     m_pinDIO.setPortMode(gpio_input);
 	m_pinClk.writeBit(0);
 	m_pinDIO.writeBit(0);
+}
 
-	dotsMask = hideDots;
-	digitLength = one;
-	digitMode = hide;
+void TM1637Core::setBrightness(uint8_t _brightness, bool on)
+{
+	brightness = (_brightness & 0x7) | (on? 0x08 : 0x00);
+}
+
+void TM1637Core::updateBrightness()
+{
+	flush(0);
+}
 
+void TM1637Core::resync()
+{
+	// Após uma perda de alimentação o estado do TM1637 é desconhecido: descarta
+	// os comandos em cache e reenvia todo o conteúdo conhecido
+	lastDataCommand = 0;
+	lastControl = 0;
+	flush(knownMask);
 }
 
-void TM1637Display::setBrightness(uint8_t _brightness, bool on)
+void TM1637Core::setSegments(const uint8_t segments[], digitPosition pos)
 {
-	brightness = (brightness & 0x7) | (on? 0x08 : 0x00);
+	setSegments(segments, pos, digitLength);
 }
 
-void TM1637Display::setSegments(const uint8_t segments[], digitPosition pos)
+void TM1637Core::setLayout(const tm1637_Layout &layout)
 {
-	start();
-	writeByte(TM1637_I2C_COMM1);
-	stop();
+	layoutDigits = layout.digits;
+	rotateSegments = layout.upsideDown;
 
-	start();
-	writeByte(TM1637_I2C_COMM2 + (pos & 0x03));
+	for (uint8_t k = 0; k < layoutDigits; k++)
+		gridMap[k] = layout.grid[layout.upsideDown ? layoutDigits - 1 - k : k];
 
-	for (uint8_t k=0; k < digitLength; k++)
-		writeByte(segments[k]);
+	knownMask = 0;
+}
 
-	stop();
+uint8_t TM1637Core::getDigits() const
+{
+	return layoutDigits;
+}
 
-	start();
-	writeByte(TM1637_I2C_COMM3 + (brightness & 0x0f));
-	stop();
+void TM1637Core::setSegments(const uint8_t segments[], digitPosition pos, numLength length)
+{
+	flush(updateShadow(segments, pos, length));
 }
 
-void TM1637Display::setSegments(const uint8_t segments[], digitPosition pos, numLength length)
+uint8_t TM1637Core::updateShadow(const uint8_t segments[], digitPosition pos, numLength length)
 {
+	uint8_t dirty = 0;
+
+	// Atualiza a cópia da RAM do display, já no grid e na orientação do
+	// módulo, e marca apenas os grids alterados
+	for (uint8_t k = 0; k < length && pos + k < layoutDigits; k++) {
+		uint8_t addr = gridMap[pos + k];
+		uint8_t bit = 1 << addr;
+		uint8_t value = rotateSegments ? tm1637_rotateSegments(segments[k]) : segments[k];
+
+		if ((knownMask & bit) && shadow[addr] == value)
+			continue;
+
+		shadow[addr] = value;
+		knownMask |= bit;
+		dirty |= bit;
+	}
+
+	return dirty;
+}
+
+void TM1637Core::composeSegments(const uint8_t segments[], digitPosition pos, numLength length)
+{
+	for (uint8_t k = 0; k < length && pos + k < TM1637_MAX_DIGITS; k++)
+		back[pos + k] = segments[k];
+}
 
-	start();
-	writeByte(TM1637_I2C_COMM1);
-	stop();
+void TM1637Core::composeDigits(const uint8_t values[], digitPosition pos, numLength length)
+{
+	for (uint8_t k = 0; k < length && pos + k < TM1637_MAX_DIGITS; k++)
+		back[pos + k] = encodeDigit(values[k]);
+}
 
-	start();
-	writeByte(TM1637_I2C_COMM2 + (pos & 0x03));
+void TM1637Core::composeDots(uint8_t dots)
+{
+	backDots = dots;
+}
 
-	for (uint8_t k=0; k < length; k++)
-	  writeByte(segments[k]);
+void TM1637Core::composeBlink(uint8_t mask)
+{
+	blinkMask = mask;
+}
 
-	stop();
+void TM1637Core::composeClear()
+{
+	for (uint8_t k = 0; k < TM1637_MAX_DIGITS; k++)
+		back[k] = 0;
 
-	start();
-	writeByte(TM1637_I2C_COMM3 + (brightness & 0x0f));
-	stop();
+	backDots = 0;
+	blinkMask = 0;
 }
 
-void TM1637Display::clear()
+void TM1637Core::setBlinkVisible(bool visible)
 {
-    uint8_t data[] = { 0,0};
-	setSegments(data,first,two);
-	setSegments(data,third,two);
+	blinkVisible = visible;
 }
 
-void TM1637Display::ligthSegments()
+void TM1637Core::commit()
 {
-	writeWithDots(8,fourth,showDots,hide,one);
-	writeWithDots(8,third,showDots,hide,one);
-	writeWithDots(8,second,showDots,hide,one);
-	writeWithDots(8,first,showDots,hide,one);
+	uint8_t frame[TM1637_MAX_DIGITS];
+	uint8_t dots = backDots;
+
+	for (uint8_t k = 0; k < layoutDigits; k++) {
+		frame[k] = back[k] | (dots & 0x80);
+		dots <<= 1;
+
+		if (!blinkVisible && (blinkMask & (1 << k)))
+			frame[k] = 0;
+	}
+
+	// A cópia da RAM e o envio formam uma única seção para as interrupções
+	// que escrevem no display (veja isIdle())
+	transferring = true;
+	flush(updateShadow(frame, first, (numLength)layoutDigits), true);
+	transferring = false;
 }
 
-void TM1637Display::setDigitMode(leadingZero _digitMode) {
+void TM1637Core::flush(uint8_t dirty, bool singleBurst)
+{
+	uint8_t control = TM1637_I2C_COMM3 + (brightness & 0x0f);
+
+	if (dirty == 0 && control == lastControl)
+		return;
+
+	// Do cálculo do modo de dados até o envio, uma leitura de teclas mudaria o
+	// modo em uso no TM1637
+	transferring = true;
+
+	tm1637_Transfer transfer;
+	transfer.clear();
+
+	if (dirty != 0 && singleBurst) {
+		uint8_t low = 0;
+		uint8_t high = TM1637_MAX_DIGITS - 1;
+
+		while (!(dirty & (1 << low)))
+			low++;
+		while (!(dirty & (1 << high)))
+			high--;
+
+		appendDataCommand(transfer, TM1637_I2C_COMM1);
+		transfer.beginCommand();
+		transfer.append(TM1637_I2C_COMM2 + low);
+
+		// Grids intermediários fora do layout não têm conteúdo conhecido e
+		// são enviados apagados
+		for (uint8_t addr = low; addr <= high; addr++) {
+			if (!(knownMask & (1 << addr))) {
+				shadow[addr] = 0;
+				knownMask |= 1 << addr;
+			}
+			transfer.append(shadow[addr]);
+		}
+	}
+	else if (dirty != 0) {
+		uint8_t runStart[TM1637_MAX_DIGITS / 2];
+		uint8_t runLength[TM1637_MAX_DIGITS / 2];
+		uint8_t runs = 0;
+		uint8_t changed = 0;
+
+		// Agrupa os dígitos alterados em sequências contíguas. Reenviar um único
+		// dígito inalterado entre duas sequências custa o mesmo byte que um novo
+		// endereço e ainda economiza um par start/stop.
+		for (uint8_t addr = 0; addr < TM1637_MAX_DIGITS; addr++) {
+			if (!(dirty & (1 << addr)))
+				continue;
+
+			changed++;
+			if (runs != 0) {
+				uint8_t end = runStart[runs - 1] + runLength[runs - 1];
+
+				if (addr == end || (addr == end + 1 && (knownMask & (1 << end)))) {
+					runLength[runs - 1] = addr - runStart[runs - 1] + 1;
+					continue;
+				}
+			}
+			runStart[runs] = addr;
+			runLength[runs] = 1;
+			runs++;
+		}
+
+		// Custo em bytes: auto incremento envia endereço + dados por sequência,
+		// endereço fixo envia endereço + dado por dígito alterado. O comando de
+		// modo só custa um byte se for diferente do último enviado.
+		uint8_t autoCost = (lastDataCommand == TM1637_I2C_COMM1) ? 0 : 1;
+		for (uint8_t r = 0; r < runs; r++)
+			autoCost += 1 + runLength[r];
+		uint8_t fixedCost = (lastDataCommand == TM1637_I2C_COMM1_FIXED) ? 0 : 1;
+		fixedCost += 2 * changed;
+
+		if (fixedCost < autoCost) {
+			appendDataCommand(transfer, TM1637_I2C_COMM1_FIXED);
+
+			for (uint8_t addr = 0; addr < TM1637_MAX_DIGITS; addr++) {
+				if (!(dirty & (1 << addr)))
+					continue;
+				transfer.beginCommand();
+				transfer.append(TM1637_I2C_COMM2 + addr);
+				transfer.append(shadow[addr]);
+			}
+		}
+		else {
+			appendDataCommand(transfer, TM1637_I2C_COMM1);
+
+			for (uint8_t r = 0; r < runs; r++) {
+				transfer.beginCommand();
+				transfer.append(TM1637_I2C_COMM2 + runStart[r]);
+				for (uint8_t k = 0; k < runLength[r]; k++)
+					transfer.append(shadow[runStart[r] + k]);
+			}
+		}
+	}
+
+	if (control != lastControl) {
+		transfer.beginCommand();
+		transfer.append(control);
+		lastControl = control;
+	}
+
+	transmit(transfer);
+	transferring = false;
+}
+
+void TM1637Core::appendDataCommand(tm1637_Transfer &transfer, uint8_t command)
+{
+	if (command == lastDataCommand)
+		return;
+
+	transfer.beginCommand();
+	transfer.append(command);
+	lastDataCommand = command;
+}
+
+void TM1637Core::attachBus(TM1637Bus *bus)
+{
+	this->bus = bus;
+}
+
+uint8_t TM1637Core::readKeys()
+{
+	uint8_t code;
+
+	while (!tryReadKeys(code)) {}
+
+	return code;
+}
+
+bool TM1637Core::isIdle() const
+{
+	return !transferring && (bus == nullptr || !bus->isBusy());
+}
+
+bool TM1637Core::tryReadKeys(uint8_t &code)
+{
+	if (!isIdle())
+		return false;
+
+	// Uma interrupção de maior prioridade que escreva no display encontra a
+	// leitura em andamento e adia a escrita
+	transferring = true;
+	code = readBlocking(TM1637_I2C_COMM1_READ);
+	transferring = false;
+
+	// O TM1637 fica em modo de leitura; a próxima escrita reenvia o modo
+	lastDataCommand = TM1637_I2C_COMM1_READ;
+
+	return true;
+}
+
+void TM1637Core::transmit(const tm1637_Transfer &transfer)
+{
+	for (uint8_t i = 0; i < transfer.size; i += transfer.data[i] + 1) {
+		busStats.transactions++;
+		busStats.bytes += transfer.data[i];
+	}
+
+	if (bus != nullptr) {
+		while (!bus->submit(transfer)) {}
+		return;
+	}
+
+	sendBlocking(transfer);
+}
+
+void TM1637Core::writeFrame(const uint8_t segments[], numLength length)
+{
+	setSegments(segments, first, length);
+}
+
+void TM1637Core::writeDigits(const uint8_t values[], twoDots dots, numLength length)
+{
+	uint8_t frame[TM1637_MAX_DIGITS];
+
+	for (uint8_t k = 0; k < length; k++)
+		frame[k] = encodeDigit(values[k]);
+
+	if (dots != 0)
+		writeDots(dots, frame, length);
+
+	writeFrame(frame, length);
+}
+
+void TM1637Core::writeText(const char text[], digitPosition pos)
+{
+	uint8_t frame[TM1637_MAX_DIGITS];
+
+	if (pos >= layoutDigits)
+		return;
+
+	uint8_t length = tm1637_encodeText(text, frame, layoutDigits - pos);
+	writeTextSegments(frame, length, pos);
+}
+
+void TM1637Core::writeTextSegments(const uint8_t segments[], uint8_t length,
+		digitPosition pos)
+{
+	uint8_t frame[TM1637_MAX_DIGITS];
+
+	if (pos >= layoutDigits)
+		return;
+
+	uint8_t width = layoutDigits - pos;
+
+	for (uint8_t k = 0; k < width; k++)
+		frame[k] = (k < length) ? segments[k] : 0;
+
+	setSegments(frame, pos, (numLength)width);
+}
+
+void TM1637Core::clear()
+{
+    uint8_t data[] = { 0, 0, 0, 0, 0, 0 };
+	writeFrame(data, (numLength)layoutDigits);
+}
+
+void TM1637Core::ligthSegments()
+{
+	uint8_t eights[] = { 8, 8, 8, 8, 8, 8 };
+	writeDigits(eights, showDots, (numLength)layoutDigits);
+}
+
+void TM1637Core::setDigitMode(leadingZero _digitMode) {
 	digitMode = _digitMode;
 }
 
-void TM1637Display::setLength(numLength _length) {
+void TM1637Core::setLength(numLength _length) {
 	digitLength = _length;
 }
 
-void TM1637Display::setDoubleDots(bool on)
+void TM1637Core::setDoubleDots(bool on)
 {
 	dotsMask = on ? showDots : hideDots;
 }
 
-void TM1637Display::write(int num, digitPosition pos)
+void TM1637Core::write(int num, digitPosition pos)
 {
 	writeWithDots(num, pos, hideDots, digitMode, digitLength);
 }
 
-void TM1637Display::write(int num, digitPosition pos,
+void TM1637Core::write(int num, digitPosition pos,
 		leadingZero leading_zero, numLength length)
 {
 	writeWithDots(num, pos, dotsMask, leading_zero, length);
 }
 
-void TM1637Display::writeWithDots(int num, digitPosition pos)
+void TM1637Core::writeWithDots(int num, digitPosition pos)
 {
-	showNumberBaseEx(num < 0? -10 : 10, num < 0? -num : num, dotsMask, digitMode, digitLength, pos);
+	writeWithDots(num, pos, dotsMask, digitMode, digitLength);
 }
 
-void TM1637Display::writeWithDots(int num, digitPosition pos, twoDots dots, leadingZero leading_zero,
+void TM1637Core::writeWithDots(int num, digitPosition pos, twoDots dots, leadingZero leading_zero,
                                     numLength length)
 {
-	showNumberBaseEx(num < 0? -10 : 10, num < 0? -num : num, dots, leading_zero, length, pos);
+	uint32_t magnitude = num < 0? -(uint32_t)num : num;
+	uint8_t available = length - (num < 0? 1 : 0);
+
+	// Números que não cabem em @ref length dígitos passam a ser exibidos com
+	// prefixo SI
+	if (!tm1637_fitsDigits(magnitude, available)) {
+		writeScaled(num, pos, length);
+		return;
+	}
+
+	// Acima de 16 bits (65536 a 999999 em 5 ou 6 dígitos) o formatador de
+	// showNumberBaseEx() truncaria: usa o de 32 bits, com os mesmos zeros à
+	// esquerda e pontos
+	if (magnitude > 0xFFFF) {
+		uint8_t digits[TM1637_MAX_DIGITS];
+
+		formatDecimal(num < 0, magnitude, 0, length, digits);
+		for (uint8_t k = 0; leading_zero && k < length && digits[k] == 0; k++)
+			digits[k] = encodeDigit(0);
+		if (dots != 0)
+			writeDots(dots, digits, length);
+
+		setSegments(digits, pos, length);
+		return;
+	}
+
+	showNumberBaseEx(num < 0? -10 : 10, magnitude, dots, leading_zero, length, pos);
 }
 
-void TM1637Display::writeHexadecimal(uint16_t num, digitPosition pos)
+void TM1637Core::writeHexadecimal(uint16_t num, digitPosition pos)
 {
 	showNumberBaseEx(16, num, dotsMask, digitMode, digitLength, pos);
 }
 
-void TM1637Display::writeHexadecimal(uint16_t num, digitPosition pos, twoDots dots, leadingZero leading_zero,
+void TM1637Core::writeHexadecimal(uint16_t num, digitPosition pos, twoDots dots, leadingZero leading_zero,
                                     numLength length)
 {
 	showNumberBaseEx(16, num, dots, leading_zero, length, pos);
 }
 
-void TM1637Display::showNumberBaseEx(int8_t base, uint16_t num, twoDots dots, leadingZero leading_zero,
+void TM1637Core::showNumberBaseEx(int8_t base, uint16_t num, twoDots dots, leadingZero leading_zero,
                                     numLength length, digitPosition pos)
+{
+    uint8_t digits[TM1637_MAX_DIGITS];
+
+    formatNumber(base, num, dots, leading_zero, length, digits);
+    setSegments(digits, pos, length);
+}
+
+/*!
+ * Divisão por 10 sem o divisor em software da libgcc: (n * 0xCCCD) >> 19 é
+ * exato para qualquer valor de 16 bits e custa uma multiplicação de um ciclo
+ */
+static inline uint16_t divideBy10(uint16_t n)
+{
+	return ((uint32_t)n * 0xCCCD) >> 19;
+}
+
+void TM1637Core::formatNumber(int8_t base, uint16_t num, twoDots dots, leadingZero leading_zero,
+                                    numLength length, uint8_t digits[])
 {
     bool negative = false;
 	if (base < 0) {
@@ -218,9 +559,6 @@ void TM1637Display::showNumberBaseEx(int8_t base, uint16_t num, twoDots dots, le
 		negative = true;
 	}
 
-
-    uint8_t digits[4];
-
 	if (num == 0 && !leading_zero) {
 		for(uint8_t i = 0; i < (length-1); i++)
 			digits[i] = 0;
@@ -228,9 +566,21 @@ void TM1637Display::showNumberBaseEx(int8_t base, uint16_t num, twoDots dots, le
 	}
 	else {
 		
+		// Um dígito por iteração, sem divisão: nibbles em hexadecimal e
+		// multiplicação pelo recíproco em decimal
 		for(int i = length-1; i >= 0; --i)
 		{
-		    uint8_t digit = num % base;
+		    uint16_t quotient;
+		    uint8_t digit;
+
+		    if (base == 16) {
+		        quotient = num >> 4;
+		        digit = num & 0x0f;
+		    }
+		    else {
+		        quotient = divideBy10(num);
+		        digit = num - quotient * 10;
+		    }
 			
 			if (digit == 0 && num == 0 && leading_zero == false)
 
@@ -243,94 +593,300 @@ void TM1637Display::showNumberBaseEx(int8_t base, uint16_t num, twoDots dots, le
 				negative = false;
 			}
 
-			num /= base;
+			num = quotient;
 		}
 
 		if(dots != 0)
 		{
-			writeDots(dots, digits);
+			writeDots(dots, digits, length);
 		}
     }
-    setSegments(digits, pos, length);
 }
 
-void TM1637Display::fastDelay() {
-	unsigned int i;
-	int j;
+/*!
+ * Converte @ref n em algarismos decimais, o mais significativo primeiro, por
+ * subtrações de potências de 10: no máximo 9 por algarismo e nenhuma divisão
+ *
+ * @return O número de algarismos, sem zeros à esquerda (ao menos um)
+ */
+static uint8_t decimalDigits(uint32_t n, uint8_t digits[10])
+{
+	uint8_t count = 0;
+
+	for (uint8_t p = 0; p < 10; p++) {
+		uint8_t digit = 0;
+
+		while (n >= powersOf10[p]) {
+			n -= powersOf10[p];
+			digit++;
+		}
 
-	for (i = 0 ; i < 2; i++) {
-		for (j = 0; j < 1000; j++) {}
+		if (digit != 0 || count != 0 || p == 9)
+			digits[count++] = digit;
 	}
+
+	return count;
 }
 
-void TM1637Display::start()
+void TM1637Core::writeFixed(int32_t value, uint8_t scale)
 {
-	m_pinDIO.setPortMode(gpio_output);
-	fastDelay();
+	writeFixed(value, scale, first, (numLength)layoutDigits);
 }
 
-void TM1637Display::stop()
+void TM1637Core::writeFixed(int32_t value, uint8_t scale, digitPosition pos, numLength length)
 {
-	m_pinDIO.setPortMode(gpio_output);
-	fastDelay();
-	m_pinClk.setPortMode(gpio_input);
-	fastDelay();
-	m_pinDIO.setPortMode(gpio_input);
-	fastDelay();
+	uint8_t digits[TM1637_MAX_DIGITS];
+
+	formatFixed(value, scale, length, digits);
+	setSegments(digits, pos, length);
 }
 
-bool TM1637Display::writeByte(uint8_t b)
+void TM1637Core::writeFixedQ(int32_t value, uint8_t fracBits, uint8_t decimals)
+{
+	writeFixedQ(value, fracBits, decimals, first, (numLength)layoutDigits);
+}
+
+void TM1637Core::writeFixedQ(int32_t value, uint8_t fracBits, uint8_t decimals,
+		digitPosition pos, numLength length)
 {
-	uint8_t data = b;
+	bool negative = value < 0;
+	uint32_t magnitude = negative ? -(uint32_t)value : value;
+
+	if (decimals > 9)
+		decimals = 9;
+	if (fracBits > 31)
+		fracBits = 31;
+
+	// magnitude * 10^decimals / 2^fracBits, arredondado
+	uint64_t scaled = (uint64_t)magnitude * powersOf10[9 - decimals];
+	if (fracBits != 0)
+		scaled = (scaled + (1ULL << (fracBits - 1))) >> fracBits;
+
+	// Valores fora de 32 bits não cabem no display de qualquer forma
+	if (scaled > INT32_MAX)
+		scaled = INT32_MAX;
+
+	writeFixed(negative ? -(int32_t)scaled : (int32_t)scaled, decimals, pos, length);
+}
+
+bool TM1637Core::formatFixed(int32_t value, uint8_t scale, numLength length, uint8_t digits[])
+{
+	bool negative = value < 0;
+
+	return formatDecimal(negative, negative ? -(uint32_t)value : value, scale, length, digits);
+}
+
+/*!
+ * Preenche os dígitos com o indicador de estouro: traços no topo para valores
+ * positivos e na base para negativos
+ */
+static bool saturate(bool negative, uint8_t length, uint8_t digits[])
+{
+	for (uint8_t k = 0; k < length; k++)
+		digits[k] = negative ? SEG_D : SEG_A;
+
+	return false;
+}
+
+bool TM1637Core::formatDecimal(bool negative, uint32_t magnitude, uint8_t scale,
+		numLength length, uint8_t digits[])
+{
+	uint8_t raw[10];
+	uint8_t num[12];
+
+	if (scale > 9)
+		scale = 9;
+
+	// num[0] recebe o vai-um do arredondamento; a parte inteira tem ao menos
+	// um algarismo (0,05 e não ,05)
+	uint8_t count = decimalDigits(magnitude, raw);
+	uint8_t n = (count > scale) ? count : scale + 1;
+
+	num[0] = 0;
+	for (uint8_t k = 0; k < n; k++)
+		num[1 + k] = (k < n - count) ? 0 : raw[k - (n - count)];
+
+	uint8_t integers = n - scale;
+	uint8_t available = length - (negative ? 1 : 0);
+
+	if (integers > available)
+		return saturate(negative, length, digits);
+
+	uint8_t decimals = scale;
+	if (integers + decimals > available)
+		decimals = available - integers;
+
+	uint8_t firstIndex = 1;
+	uint8_t lastIndex = integers + decimals;
 
+	// Arredonda pelo primeiro algarismo descartado, propagando o vai-um
+	if (decimals < scale && num[lastIndex + 1] >= 5) {
+		uint8_t i = lastIndex;
 
-	for(uint8_t i = 0; i < 8; i++) {
+		while (++num[i] == 10) {
+			num[i] = 0;
+			i--;
+		}
+	}
 
-		m_pinClk.setPortMode(gpio_output);
-		fastDelay();
+	if (num[0] != 0) {
+		firstIndex = 0;
+		integers++;
+
+		// O algarismo descartado aqui é zero, pois veio do vai-um
+		if (integers + decimals > available) {
+			if (decimals == 0)
+				return saturate(negative, length, digits);
+			decimals--;
+			lastIndex--;
+		}
+	}
 
-		if (data & 0x01)
-			m_pinDIO.setPortMode(gpio_input);
-		else
-			m_pinDIO.setPortMode(gpio_output);
+	// Sem sinal em um valor arredondado para zero
+	if (negative) {
+		negative = false;
+		for (uint8_t i = firstIndex; i <= lastIndex; i++) {
+			if (num[i] != 0) {
+				negative = true;
+				break;
+			}
+		}
+	}
 
-		fastDelay();
+	uint8_t k = 0;
+	uint8_t used = lastIndex - firstIndex + 1 + (negative ? 1 : 0);
 
+	while (k < length - used)
+		digits[k++] = 0;
+	if (negative)
+		digits[k++] = minusSegments;
 
-		m_pinClk.setPortMode(gpio_input);
-		fastDelay();
-		data = data >> 1;
+	for (uint8_t i = firstIndex; i <= lastIndex; i++) {
+		digits[k] = encodeDigit(num[i]);
+		if (decimals != 0 && i == firstIndex + integers - 1)
+			digits[k] |= SEG_DP;
+		k++;
 	}
 
-	m_pinClk.setPortMode(gpio_output);
-	m_pinDIO.setPortMode(gpio_input);
-	fastDelay();
+	return true;
+}
+
+void TM1637Core::writeScaled(int32_t value)
+{
+	writeScaled(value, first, (numLength)layoutDigits);
+}
+
+void TM1637Core::writeScaled(int32_t value, digitPosition pos, numLength length)
+{
+	uint8_t digits[TM1637_MAX_DIGITS];
+	bool negative = value < 0;
+
+	formatScaled(negative, negative ? -(uint32_t)value : value, length, digits);
+	setSegments(digits, pos, length);
+}
+
+void TM1637Core::writeScaledUnsigned(uint32_t value)
+{
+	writeScaledUnsigned(value, first, (numLength)layoutDigits);
+}
 
+void TM1637Core::writeScaledUnsigned(uint32_t value, digitPosition pos, numLength length)
+{
+	uint8_t digits[TM1637_MAX_DIGITS];
+
+	formatScaled(false, value, length, digits);
+	setSegments(digits, pos, length);
+}
 
-	m_pinClk.setPortMode(gpio_input);
-	fastDelay();
-	uint8_t ack = m_pinDIO.readBit();
-	if (ack == 0) {
-		m_pinDIO.setPortMode(gpio_output);
+bool TM1637Core::formatScaled(bool negative, uint32_t magnitude, numLength length,
+		uint8_t digits[])
+{
+	static const char prefixes[] = { 'k', 'M', 'G' };
+
+	if (formatDecimal(negative, magnitude, 0, length, digits))
+		return true;
+
+	if (length < 2)
+		return false;
+
+	// Mil, milhão e bilhão: o mesmo módulo com 3, 6 ou 9 casas decimais, das
+	// quais formatDecimal() mantém as que couberem antes do prefixo
+	for (uint8_t p = 0; p < sizeof(prefixes); p++) {
+		if (formatDecimal(negative, magnitude, 3 * (p + 1), (numLength)(length - 1), digits)) {
+			digits[length - 1] = tm1637_encodeChar(prefixes[p]);
+			return true;
+		}
 	}
 
-	fastDelay();
-	m_pinClk.setPortMode(gpio_output);
-	fastDelay();
+	return saturate(negative, length, digits);
+}
 
-	return ack;
+void TM1637Core::setBusFrequency(busFrequency frequency)
+{
+	timing.frequency = frequency;
+	timing.calibratedClock = 0;
+}
+
+tm1637_BusStats TM1637Core::getBusStats() const
+{
+	return busStats;
+}
+
+void TM1637Core::resetBusStats()
+{
+	busStats.bytes = 0;
+	busStats.transactions = 0;
+}
+
+void TM1637Display::calibrateTiming()
+{
+	tm1637_calibrate(m_pinDIO, timing);
+}
+
+void TM1637Display::sendBlocking(const tm1637_Transfer &transfer)
+{
+	if (timing.calibratedClock != SystemCoreClock)
+		calibrateTiming();
+
+	tm1637_send(m_pinClk, m_pinDIO, timing, transfer);
+}
+
+uint8_t TM1637Display::readBlocking(uint8_t command)
+{
+	if (timing.calibratedClock != SystemCoreClock)
+		calibrateTiming();
+
+	return tm1637_read(m_pinClk, m_pinDIO, timing, command);
+}
+
+void TM1637Display::start()
+{
+	if (timing.calibratedClock != SystemCoreClock)
+		calibrateTiming();
+
+	tm1637_start(m_pinClk, m_pinDIO, timing);
+}
+
+void TM1637Display::stop()
+{
+	tm1637_stop(m_pinClk, m_pinDIO, timing);
+}
+
+bool TM1637Display::writeByte(uint8_t b)
+{
+	return tm1637_writeByte(m_pinClk, m_pinDIO, timing, b);
 }
 
-void TM1637Display::writeDots(uint8_t dots, uint8_t* digits)
+void TM1637Core::writeDots(uint8_t dots, uint8_t* digits, numLength length)
 {
-    for(int i = 0; i < 4; ++i)
+    for(int i = 0; i < length; ++i)
     {
         digits[i] |= (dots & 0x80);
         dots <<= 1;
     }
 }
 
-uint8_t TM1637Display::encodeDigit(uint8_t digit)
+uint8_t TM1637Core::encodeDigit(uint8_t digit)
 {
 	return digitToSegment[digit & 0x0f];
 }
@@ -48,6 +48,12 @@
 
 #include <inttypes.h>
 #include "mkl_DevGPIO.h"
+#include "TM1637Bus.h"
+#include "TM1637BitBang.h"
+#include "TM1637Font.h"
+
+// Número de posições (grids) endereçáveis pelo TM1637
+#define TM1637_MAX_DIGITS 6
 
 #define SEG_A   0b00000001
 #define SEG_B   0b00000010
@@ -68,14 +74,18 @@ enum numLength : uint8_t {
 	one = 1,
 	two = 2,
 	three = 3,
-	four = 0
+	four = 4,
+	five = 5,
+	six = 6
 };
 
 enum digitPosition : uint8_t {
 	first = 0,
 	second = 1,
 	third = 2,
-	fourth = 3
+	fourth = 3,
+	fifth = 4,
+	sixth = 5
 };
 
 enum twoDots : uint8_t {
@@ -84,45 +94,128 @@ enum twoDots : uint8_t {
 };
 
 /*!
- *  @class    mkl_TM1637.
- *
- *  @brief    A classe implementa o serviço de exibição
- *  	 	  do display TM1637.
+ * Ligação das posições do módulo aos grids do TM1637
  *
- *  @details  Esta classe implementa o serviço de exibiçãodo display utilizando o
- *            periférico correspondente.
+ * As posições são numeradas da esquerda para a direita, como em setSegments().
+ * Módulos montados de cabeça para baixo têm a ordem das posições invertida e
+ * os segmentos girados em 180 graus.
+ */
+struct tm1637_Layout {
+	uint8_t digits;						// Número de posições do módulo (1 a 6)
+	uint8_t grid[TM1637_MAX_DIGITS];	// Grid ligado a cada posição
+	bool upsideDown;					// Módulo montado de cabeça para baixo
+};
+
+// Módulo de 4 dígitos com os grids em ordem
+constexpr tm1637_Layout tm1637_layout4 = { 4, { 0, 1, 2, 3, 4, 5 }, false };
+
+// Módulo comum de 6 dígitos, com os grids em dois grupos de três invertidos
+constexpr tm1637_Layout tm1637_layout6 = { 6, { 2, 1, 0, 5, 4, 3 }, false };
+
+/*!
+ * Verifica, em tempo de compilação, se cada posição usa um grid distinto e válido
  *
- *  @section  EXAMPLES USAGE
+ * 	static_assert(tm1637_isValidLayout(myLayout), "layout inválido");
+ */
+constexpr bool tm1637_isValidLayout(const tm1637_Layout &layout)
+{
+	uint8_t used = 0;
+
+	if (layout.digits == 0 || layout.digits > TM1637_MAX_DIGITS)
+		return false;
+
+	for (uint8_t k = 0; k < layout.digits; k++) {
+		if (layout.grid[k] >= TM1637_MAX_DIGITS || (used & (1 << layout.grid[k])))
+			return false;
+		used |= 1 << layout.grid[k];
+	}
+
+	return true;
+}
+
+static_assert(tm1637_isValidLayout(tm1637_layout4), "tm1637_layout4 inválido");
+static_assert(tm1637_isValidLayout(tm1637_layout6), "tm1637_layout6 inválido");
+
+/*!
+ * Gira os segmentos de um dígito em 180 graus (A<->D, B<->E, C<->F)
  *
- *            Uso dos métodos para exibição de dados no display.
+ * O ponto decimal não tem posição equivalente e é mantido.
+ */
+constexpr uint8_t tm1637_rotateSegments(uint8_t segments)
+{
+	return (segments & (SEG_G | SEG_DP))
+			| ((segments & (SEG_A | SEG_B | SEG_C)) << 3)
+			| ((segments >> 3) & (SEG_A | SEG_B | SEG_C));
+}
+
+/*!
+ * Indica se um valor de módulo @ref magnitude cabe em @ref digits algarismos
  *
- *              display.showNumberDec(24, false, 1, 0);
- *              display.setSegments(segments[], 2, 2);
+ * Usada por writeWithDots() para decidir entre o formatador com pontos e zeros
+ * à esquerda e writeScaled(); os limites são verificados abaixo.
  */
+constexpr bool tm1637_fitsDigits(uint32_t magnitude, uint8_t digits)
+{
+	uint32_t limit = 1;
 
-class TM1637Display {
+	if (digits == 0)
+		return false;
+	if (digits >= 10)
+		return true;
+
+	for (uint8_t k = 0; k < digits; k++)
+		limit *= 10;
+
+	return magnitude < limit;
+}
+
+static_assert(tm1637_fitsDigits(5, 1) && !tm1637_fitsDigits(10, 1), "limite de 1 dígito");
+static_assert(tm1637_fitsDigits(9999, 4) && !tm1637_fitsDigits(10000, 4), "limite de 4 dígitos");
+static_assert(tm1637_fitsDigits(70000, 6) && tm1637_fitsDigits(999999, 6)
+		&& !tm1637_fitsDigits(1000000, 6), "limite de 6 dígitos");
+static_assert(!tm1637_fitsDigits(0, 0), "sem dígitos disponíveis");
 
-public:
 /*!
- * 	Inicializa um objeto TM1637Display, defininfo os pinos
- * 	de clock e dados
+ *  @class    TM1637Core
  *
- *  @param pinClk - O valor do pino conectado ao pino de clock do periférico
- *  @param pinDIO - O valor do pino conectado ao pino DIO do módulo
- *  @param bitDelay - O delay em milissegundos entre a transição de bit no buffer conectado ao display
+ *  @brief    Serviço de exibição do TM1637, independente dos pinos.
  *
+ *  @details  Mantém a cópia da RAM do display, os comandos em cache e a
+ *            formatação dos números. O envio bloqueante por bit-bang fica a
+ *            cargo das classes derivadas, que definem como os pinos são
+ *            acessados: TM1637Display com pinos em tempo de execução e
+ *            TM1637PinDisplay com pinos em tempo de compilação.
  */
-	TM1637Display(mkl_DevGPIO pinClk, mkl_DevGPIO pinDIO);
+
+class TM1637Core {
+
+public:
 /*!
  * 	Define o nível do brilho do display
  *
- * 	A nova definição de brilho surte efeito quando um comando para a mudança dos dados exibidos
+ * 	A nova definição de brilho surte efeito no próximo envio ao display. O comando de controle
+ * 	só é transmitido quando difere do último enviado.
  *
  * 	@param brightness Um valor de 0 (menos brilho) a 7 (mais brilho)
  * 	@param on Liga ou desliga o display
  */
 	void setBrightness(uint8_t _brightness, bool on = true);
 
+/*!
+ * 	Envia apenas o comando de controle, caso o brilho tenha mudado
+ *
+ * 	Nenhum dado de segmento é enviado. Usado por TM1637Dimmer a cada tick.
+ */
+	void updateBrightness();
+
+/*!
+ * 	Ressincroniza o display com o estado mantido pelo driver
+ *
+ * 	Descarta os comandos de modo e de controle em cache e reenvia todos os dígitos
+ * 	conhecidos. Deve ser chamado quando o módulo pode ter perdido a alimentação.
+ */
+	void resync();
+
 /*!
  * 	Exibe dados selecionados por um array de segmentos no periférico
  *
@@ -137,7 +230,7 @@ public:
  * 	@param segments Um array de tamanho @ref length contendo os valores dos segmentos
  * 	@param length O número de dígitos a serem modificados
  * 	@param pos A posição de onde se inicia a modificação (0 [first] - mais a esquerda,
- * 		   3 [fourth] - mais a direita)
+ * 		   até a última posição do layout - mais a direita)
  *
  */
 	void setSegments(const uint8_t segments[], digitPosition);
@@ -145,6 +238,121 @@ public:
   //! @overload
 	void setSegments(const uint8_t segments[], digitPosition pos, numLength length);
 
+/*!
+ * 	Compõe segmentos no buffer de trás, sem enviar
+ *
+ * 	O buffer de trás pode ser montado aos poucos por várias partes do programa;
+ * 	nada chega ao display até commit(). As posições seguem o layout, como em
+ * 	setSegments().
+ */
+	void composeSegments(const uint8_t segments[], digitPosition pos, numLength length);
+
+/*!
+ * Compõe dígitos de 0 a 15 no buffer de trás, sem enviar
+ */
+	void composeDigits(const uint8_t values[], digitPosition pos, numLength length);
+
+/*!
+ * Define os pontos do buffer de trás, na máscara de writeWithDots() (bit 7 = posição 0)
+ */
+	void composeDots(uint8_t dots);
+
+/*!
+ * Define as posições que piscam (bit n = posição n); veja setBlinkVisible()
+ */
+	void composeBlink(uint8_t mask);
+
+/*!
+ * Apaga o buffer de trás, os pontos e as posições que piscam
+ */
+	void composeClear();
+
+/*!
+ * Define a fase do pisca: com false, as posições que piscam ficam apagadas no
+ * próximo commit()
+ */
+	void setBlinkVisible(bool visible);
+
+/*!
+ * 	Envia o buffer de trás ao display sem quadros intermediários
+ *
+ * 	O quadro composto é copiado para a cópia da RAM do display e as posições
+ * 	alteradas são enviadas em uma única sequência de auto incremento, do
+ * 	primeiro ao último grid alterado, de modo que o módulo nunca exibe uma
+ * 	mistura dos quadros. O buffer de trás mantém o conteúdo para a próxima
+ * 	composição.
+ *
+ * 	Pode ser chamado do laço principal com uma transferência anterior ainda em
+ * 	andamento em um barramento assíncrono: o quadro novo é enfileirado atrás
+ * 	dela. Escritas feitas por interrupções encontram o display ocupado
+ * 	(isIdle()) durante todo o commit().
+ */
+	void commit();
+
+/*!
+ * 	Exibe um quadro completo em uma única rajada
+ *
+ * 	Os dígitos são enviados a partir da posição mais à esquerda em uma única
+ * 	sequência COMM1/COMM2/COMM3, usando o auto incremento de endereço do TM1637.
+ *
+ * 	@param segments Um array de tamanho @ref length contendo os valores dos segmentos
+ * 	@param length O número de dígitos do quadro
+ */
+	void writeFrame(const uint8_t segments[], numLength length = four);
+
+/*!
+ * 	Formata e exibe um dígito por posição em uma única rajada
+ *
+ * 	Cada valor (0 a 15) é convertido para 7 segmentos no mesmo buffer e o quadro
+ * 	é enviado com writeFrame(), em vez de uma transação por dígito.
+ *
+ * 	@param values Um array de tamanho @ref length com os valores de cada dígito
+ * 	@param dots A máscara dos pontos, como em writeWithDots()
+ * 	@param length O número de dígitos do quadro
+ */
+	void writeDigits(const uint8_t values[], twoDots dots = hideDots, numLength length = four);
+
+/*!
+ * Define a ligação das posições aos grids do TM1637
+ *
+ * O mapa de grids e a rotação dos segmentos são aplicados uma única vez, quando
+ * os dígitos entram na cópia da RAM do display, de modo que posições vizinhas
+ * no módulo continuam sendo enviadas em uma única rajada quando os seus grids
+ * são contíguos. Todo o conteúdo conhecido é descartado.
+ *
+ * As tabelas são constexpr e verificadas em tempo de compilação
+ * (tm1637_isValidLayout), mas a escolha da tabela é feita em tempo de execução:
+ * o custo é uma consulta ao mapa por dígito gravado, nunca por bit, e evita
+ * que TM1637Core e todas as classes de display virem templates do layout.
+ *
+ * @param layout O layout, normalmente uma constante como tm1637_layout6
+ */
+	void setLayout(const tm1637_Layout &layout);
+
+/*!
+ * Retorna o número de posições do layout atual
+ */
+	uint8_t getDigits() const;
+
+/*!
+ * 	Exibe um texto a partir de uma posição, apagando as posições seguintes
+ *
+ * 	Os caracteres são convertidos pela fonte ASCII (TM1637Font.h), com os pontos
+ * 	juntados ao dígito anterior, e o quadro é enviado em uma única rajada.
+ * 	Caracteres além da última posição são ignorados.
+ *
+ * 	@param text O texto terminado em zero
+ * 	@param pos A posição do primeiro caractere
+ */
+	void writeText(const char text[], digitPosition pos = first);
+
+//! @overload Texto já convertido em tempo de compilação, como "Err"_seg
+	template<uint8_t N>
+	void writeText(const tm1637_Text<N> &text, digitPosition pos = first)
+	{
+		writeTextSegments(text.segments, N, pos);
+	}
+
 /*!
  * Limpa/esvazia o display
  */
@@ -166,7 +374,7 @@ public:
 /*!
  * Define o número de algarismo acesos para exibir o número
  *
- * @param _length é esse número, indo do valor one (um dígito aceso para exxibir o algarismo) até four (quatro dígitos acesos)
+ * @param _length é esse número, indo do valor one (um dígito aceso para exxibir o algarismo) até six (seis dígitos acesos)
  */
 	void setLength(numLength _length);
 
@@ -244,6 +452,67 @@ public:
 	void writeHexadecimal(uint16_t num, digitPosition pos, twoDots dots,
 			leadingZero leading_zero, numLength length);
 
+/*!
+ * Exibe um valor em ponto fixo decimal (valor / 10^scale), alinhado à direita
+ *
+ * O ponto é o segmento DP do último dígito inteiro. Se o número não couber com
+ * todas as casas decimais, a precisão é reduzida com arredondamento (metade
+ * para longe do zero); se nem a parte inteira couber, todas as posições
+ * mostram o indicador de estouro (veja writeScaled()). Só usa aritmética
+ * inteira.
+ *
+ * @param value O valor escalado, por exemplo 2315 para 23,15 com scale 2
+ * @param scale O número de casas decimais em @ref value (0 a 9)
+ * @param pos A posição do primeiro dígito
+ * @param length O número de dígitos usados, incluindo o sinal
+ */
+	void writeFixed(int32_t value, uint8_t scale);
+
+//! @overload
+	void writeFixed(int32_t value, uint8_t scale, digitPosition pos, numLength length);
+
+/*!
+ * Exibe um valor em formato Q (valor / 2^fracBits) com @ref decimals casas decimais
+ *
+ * O valor é convertido para ponto fixo decimal com uma multiplicação e um
+ * deslocamento arredondado e exibido como em writeFixed().
+ *
+ * @param fracBits O número de bits fracionários de @ref value (0 a 31)
+ * @param decimals O número máximo de casas decimais exibidas (0 a 9)
+ */
+	void writeFixedQ(int32_t value, uint8_t fracBits, uint8_t decimals);
+
+//! @overload
+	void writeFixedQ(int32_t value, uint8_t fracBits, uint8_t decimals, digitPosition pos,
+			numLength length);
+
+/*!
+ * Exibe um valor de 32 bits, reduzido com prefixo SI quando não cabe
+ *
+ * Valores que cabem são exibidos inteiros, alinhados à direita. Os demais
+ * são divididos por mil, milhão ou bilhão, com as casas decimais que couberem,
+ * e o último dígito mostra o prefixo (k, M ou G): 123456 em quatro dígitos
+ * aparece como 123k e 4567890 como 4.57M. Se nem assim couber, o display
+ * satura: segmentos A acesos em todas as posições para valores positivos e D
+ * para negativos.
+ *
+ * A conversão usa só subtrações de potências de 10, sem divisão, e pode ser
+ * repetida a cada atualização de um contador rápido.
+ *
+ * @param pos A posição do primeiro dígito
+ * @param length O número de dígitos usados, incluindo o sinal e o prefixo
+ */
+	void writeScaled(int32_t value);
+
+//! @overload
+	void writeScaled(int32_t value, digitPosition pos, numLength length);
+
+//! @overload Valor sem sinal, de 0 a 4294967295
+	void writeScaledUnsigned(uint32_t value);
+
+//! @overload
+	void writeScaledUnsigned(uint32_t value, digitPosition pos, numLength length);
+
 /*!
  * Traduz um único dígito no seu respectivo código de 7 segmentos
  *
@@ -256,28 +525,211 @@ public:
  */
 	uint8_t encodeDigit(uint8_t digit);
 
-protected:
+/*!
+ * Define a frequência alvo do clock do barramento
+ *
+ * O período de cada meio bit é derivado do clock do núcleo (SystemCoreClock) e
+ * nunca fica abaixo da largura mínima de pulso do TM1637 (400 ns), independente
+ * da frequência pedida. A recalibração acontece automaticamente no próximo
+ * comando enviado.
+ *
+ * @param frequency A frequência alvo (freq100kHz, freq250kHz ou freq500kHz)
+ */
+	void setBusFrequency(busFrequency frequency);
 
 /*!
- * Delay
+ * Recalcula os atrasos de meio bit para o clock atual do núcleo
+ *
+ * O custo de uma operação de pino é medido com o SysTick, de modo que o atraso
+ * resultante independe do nível de otimização do compilador. É chamado
+ * automaticamente quando SystemCoreClock muda (por exemplo, após
+ * BOARD_BootClockRUN() ou BOARD_BootClockVLPR()).
  */
-	void fastDelay();
+	virtual void calibrateTiming() = 0;
 
-	void start();
+/*!
+ * Retorna os contadores de tráfego enviados ao barramento
+ */
+	tm1637_BusStats getBusStats() const;
 
-	void stop();
+/*!
+ * Zera os contadores de tráfego do barramento
+ */
+	void resetBusStats();
 
-	bool writeByte(uint8_t b);
+/*!
+ * Anexa um barramento para a transmissão dos comandos
+ *
+ * Com um barramento assíncrono (por exemplo TM1637AsyncBus), os métodos de escrita
+ * retornam assim que a transferência é enfileirada. Se a fila estiver cheia, a
+ * escrita aguarda até haver espaço.
+ *
+ * @param bus O barramento, ou nullptr para voltar ao bit-bang bloqueante
+ */
+	void attachBus(TM1637Bus *bus);
+
+/*!
+ * Lê o código das teclas pressionadas (comando 0x42)
+ *
+ * Aguarda o barramento anexado ficar livre e lê por bit-bang. O código é o
+ * byte recebido do TM1637, 0xFF quando nenhuma tecla está pressionada; veja
+ * TM1637Keypad::decodeKey().
+ */
+	uint8_t readKeys();
 
-	void writeDots(uint8_t dots, uint8_t* digits);
+/*!
+ * Lê o código das teclas apenas se nenhuma escrita estiver em andamento
+ *
+ * Pode ser chamado de uma interrupção: retorna false, sem tocar nos pinos, se
+ * o laço principal estiver no meio de uma escrita ou se o barramento anexado
+ * estiver ocupado.
+ *
+ * @param code Recebe o código lido
+ */
+	bool tryReadKeys(uint8_t &code);
+
+/*!
+ * Indica que nenhuma escrita ou leitura está em andamento, no laço principal
+ * ou no barramento anexado
+ *
+ * Uma interrupção que atualiza o display deve consultar este método antes de
+ * escrever, para não aguardar um barramento que só avança em outra interrupção.
+ */
+	bool isIdle() const;
+
+protected:
+
+	friend class TM1637Benchmark;
+
+	TM1637Core();
+
+/*!
+ * Envia a transferência por bit-bang bloqueante nos pinos da classe derivada
+ */
+	virtual void sendBlocking(const tm1637_Transfer &transfer) = 0;
+
+/*!
+ * Envia um comando de leitura e retorna o byte lido, por bit-bang bloqueante
+ */
+	virtual uint8_t readBlocking(uint8_t command) = 0;
+
+	void writeDots(uint8_t dots, uint8_t* digits, numLength length);
+
+/*!
+ * Exibe os segmentos de um texto a partir de @ref pos e apaga o restante do display
+ */
+	void writeTextSegments(const uint8_t segments[], uint8_t length, digitPosition pos);
    
 	void showNumberBaseEx(int8_t base, uint16_t num, twoDots dots, leadingZero leading_zero,
            numLength length, digitPosition pos);
 
+/*!
+ * Converte o número nos códigos de 7 segmentos de cada dígito, sem enviar
+ *
+ * Usa apenas deslocamentos (base 16) ou multiplicação pelo recíproco de 10
+ * (base 10), já que o Cortex-M0+ não tem instrução de divisão. O custo é fixo
+ * por dígito.
+ *
+ * @param base 16, 10 ou -10 (número negativo)
+ * @param digits Um array de tamanho @ref length que recebe os segmentos
+ */
+	void formatNumber(int8_t base, uint16_t num, twoDots dots, leadingZero leading_zero,
+           numLength length, uint8_t digits[]);
+
+/*!
+ * Converte um valor em ponto fixo decimal nos segmentos de @ref length dígitos
+ *
+ * @return false se a parte inteira não couber; os dígitos recebem o
+ *         indicador de estouro
+ */
+	bool formatFixed(int32_t value, uint8_t scale, numLength length, uint8_t digits[]);
+
+/*!
+ * Converte sinal e módulo em ponto fixo decimal; base de formatFixed() e formatScaled()
+ */
+	bool formatDecimal(bool negative, uint32_t magnitude, uint8_t scale, numLength length,
+			uint8_t digits[]);
+
+/*!
+ * Converte sinal e módulo em @ref length dígitos, com prefixo SI se necessário
+ *
+ * @return false se nem com o prefixo o valor couber; os dígitos recebem o
+ *         indicador de estouro
+ */
+	bool formatScaled(bool negative, uint32_t magnitude, numLength length, uint8_t digits[]);
+
+/*!
+ * Envia ao display os dígitos marcados na máscara @ref dirty
+ *
+ * Escolhe entre o modo de endereço fixo (0x44) e o auto incremento (0x40) pelo
+ * menor número de bytes no barramento. Sem dígitos alterados e sem mudança de
+ * brilho pendente, nada é enviado.
+ *
+ * @param singleBurst Envia os grids do primeiro ao último alterado em uma única
+ *        sequência de auto incremento, como em commit()
+ */
+	void flush(uint8_t dirty, bool singleBurst = false);
+
+/*!
+ * Copia segmentos para a cópia da RAM do display, aplicando o layout
+ *
+ * @return A máscara dos grids alterados
+ */
+	uint8_t updateShadow(const uint8_t segments[], digitPosition pos, numLength length);
+
+/*!
+ * Acrescenta o comando de modo de dados, caso seja diferente do último enviado
+ */
+	void appendDataCommand(tm1637_Transfer &transfer, uint8_t command);
+
+/*!
+ * Envia a transferência pelo barramento anexado ou por bit-bang bloqueante
+ */
+	void transmit(const tm1637_Transfer &transfer);
+
+/*!
+ * Temporização do barramento
+ */
+	tm1637_Timing timing = { freq250kHz, 0, 0, 0 };
+
 private:
-	mkl_DevGPIO m_pinClk;
-	mkl_DevGPIO m_pinDIO;
-	uint8_t brightness;
+	uint8_t brightness = 0x0f;
+
+	tm1637_BusStats busStats = { 0, 0 };
+	TM1637Bus *bus = nullptr;
+
+/*!
+ * Cópia da RAM do display e máscara dos grids com conteúdo conhecido, ambas
+ * indexadas pelo grid
+ */
+	uint8_t shadow[TM1637_MAX_DIGITS];
+	uint8_t knownMask = 0;
+
+/*!
+ * Grid de cada posição, já com a inversão de ordem do layout aplicada
+ */
+	uint8_t gridMap[TM1637_MAX_DIGITS] = { 0, 1, 2, 3, 4, 5 };
+	uint8_t layoutDigits = 4;
+	bool rotateSegments = false;
+
+/*!
+ * Buffer de trás de commit(), indexado pela posição
+ */
+	uint8_t back[TM1637_MAX_DIGITS] = { 0, 0, 0, 0, 0, 0 };
+	uint8_t backDots = 0;
+	uint8_t blinkMask = 0;
+	bool blinkVisible = true;
+
+/*!
+ * Últimos comandos de modo de dados e de controle enviados (0 = desconhecido)
+ */
+	uint8_t lastDataCommand = 0;
+	uint8_t lastControl = 0;
+
+/*!
+ * Indica uma escrita ou leitura em andamento, consultado por isIdle()
+ */
+	volatile bool transferring = false;
 
 /*!
  * Atributos enumerados
@@ -288,4 +740,56 @@ private:
 	twoDots dotsMask = hideDots;
 };
 
+/*!
+ *  @class    mkl_TM1637.
+ *
+ *  @brief    A classe implementa o serviço de exibição
+ *  	 	  do display TM1637.
+ *
+ *  @details  Esta classe implementa o serviço de exibiçãodo display utilizando o
+ *            periférico correspondente.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Uso dos métodos para exibição de dados no display.
+ *
+ *              display.showNumberDec(24, false, 1, 0);
+ *              display.setSegments(segments[], 2, 2);
+ */
+
+class TM1637Display : public TM1637Core {
+
+public:
+/*!
+ * 	Inicializa um objeto TM1637Display, defininfo os pinos
+ * 	de clock e dados
+ *
+ *  @param pinClk - O valor do pino conectado ao pino de clock do periférico
+ *  @param pinDIO - O valor do pino conectado ao pino DIO do módulo
+ *  @param bitDelay - O delay em milissegundos entre a transição de bit no buffer conectado ao display
+ *
+ */
+	TM1637Display(mkl_DevGPIO pinClk, mkl_DevGPIO pinDIO);
+
+	void calibrateTiming();
+
+protected:
+
+	friend class TM1637Benchmark;
+
+	void sendBlocking(const tm1637_Transfer &transfer);
+
+	uint8_t readBlocking(uint8_t command);
+
+	void start();
+
+	void stop();
+
+	bool writeByte(uint8_t b);
+
+private:
+	mkl_DevGPIO m_pinClk;
+	mkl_DevGPIO m_pinDIO;
+};
+
 #endif // __TM1637DISPLAY__
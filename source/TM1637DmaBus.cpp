@@ -0,0 +1,213 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Transmissão para o TM1637 por DMA de formas de onda no GPIO.
+ *
+ * @file        TM1637DmaBus.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637DmaBus.h"
+#include "fsl_dmamux.h"
+#include "fsl_pit.h"
+#include "fsl_clock.h"
+
+static void dmaCallback(dma_handle_t *handle, void *userData)
+{
+	static_cast<TM1637DmaBus *>(userData)->handleComplete();
+}
+
+TM1637DmaBus::TM1637DmaBus(gpio_Pin pinClk, gpio_Pin pinDIO, uint8_t channel,
+		tm1637_AckPolicy ackPolicy, uint8_t captureChannel)
+{
+	uint32_t clkNumber = pinClk & 0xFF;
+	uint32_t dioNumber = pinDIO & 0xFF;
+
+	clkMask = 1 << (clkNumber & 0x07);
+	dioMask = 1 << (dioNumber & 0x07);
+
+	// Pinos fora do mesmo byte da mesma porta são recusados por begin()
+	otherMask = ((pinClk >> 8) == (pinDIO >> 8) && (clkNumber >> 3) == (dioNumber >> 3)) ? 0 : 0xFF;
+
+	uint32_t gpioBase = GPIOA_BASE + 0x40 * (pinClk >> 8);
+	laneDDR = (volatile uint8_t *)(gpioBase + 0x14 + (clkNumber >> 3));
+	lanePDIR = (volatile uint8_t *)(gpioBase + 0x10 + (clkNumber >> 3));
+
+	dmaChannel = channel;
+	this->captureChannel = captureChannel;
+	ack = ackPolicy;
+}
+
+bool TM1637DmaBus::begin(busFrequency frequency)
+{
+	if (otherMask != 0 || dmaChannel >= FSL_FEATURE_PIT_TIMER_COUNT)
+		return false;
+
+	if (ack == ackSample &&
+			(captureChannel == dmaChannel || captureChannel >= FSL_FEATURE_DMA_MODULE_CHANNEL))
+		return false;
+
+	// Um disparo do PIT por passo da forma de onda
+	pit_config_t config;
+	PIT_GetDefaultConfig(&config);
+	PIT_Init(PIT, &config);
+	PIT_SetTimerPeriod(PIT, (pit_chnl_t)dmaChannel,
+			CLOCK_GetBusClkFreq() / (TM1637_DMA_STEPS_PER_BIT * frequency) - 1);
+
+	// Fonte sempre ativa, cadenciada pelo disparo periódico do PIT
+	DMAMUX_Init(DMAMUX0);
+	DMAMUX_SetSource(DMAMUX0, dmaChannel, (uint32_t)kDmaRequestMux0AlwaysOn60 + dmaChannel);
+	DMAMUX_EnablePeriodTrigger(DMAMUX0, dmaChannel);
+	DMAMUX_EnableChannel(DMAMUX0, dmaChannel);
+
+	DMA_Init(DMA0);
+	DMA_CreateHandle(&dmaHandle, DMA0, dmaChannel);
+	DMA_SetCallback(&dmaHandle, dmaCallback, this);
+
+	return true;
+}
+
+bool TM1637DmaBus::submit(const tm1637_Transfer &transfer)
+{
+	// A interrupção de fim de transferência também consulta running e pending
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (running) {
+		bool accepted = !hasPending;
+		if (accepted) {
+			pending = transfer;
+			hasPending = true;
+		}
+		__set_PRIMASK(primask);
+		return accepted;
+	}
+
+	running = true;
+	__set_PRIMASK(primask);
+
+	start(compile(transfer));
+	return true;
+}
+
+bool TM1637DmaBus::isBusy() const
+{
+	return running;
+}
+
+uint32_t TM1637DmaBus::getNackCount() const
+{
+	return nacks;
+}
+
+void TM1637DmaBus::handleComplete()
+{
+	PIT_StopTimer(PIT, (pit_chnl_t)dmaChannel);
+
+	if (ack == ackSample) {
+		for (uint8_t i = 0; i < acks; i++) {
+			if (capture[ackSlot[i]] & dioMask)
+				nacks++;
+		}
+	}
+
+	if (hasPending) {
+		hasPending = false;
+		start(compile(pending));
+		return;
+	}
+
+	running = false;
+	exec();
+}
+
+void TM1637DmaBus::emit(bool clkLow, bool dioLow)
+{
+	// Pino em saída = nível baixo; em entrada = liberado para o pull-up
+	wave[steps++] = base | (clkLow ? clkMask : 0) | (dioLow ? dioMask : 0);
+}
+
+uint16_t TM1637DmaBus::compile(const tm1637_Transfer &transfer)
+{
+	// Direção atual dos demais pinos do mesmo byte do PDDR
+	base = *laneDDR & ~(clkMask | dioMask);
+	steps = 0;
+	acks = 0;
+
+	for (uint8_t i = 0; i < transfer.size; i += transfer.data[i] + 1) {
+		uint8_t count = transfer.data[i];
+		bool dioLow = true;
+
+		if (count == 0)
+			continue;
+
+		// Start: DIO desce com o clock alto
+		emit(false, true);
+
+		for (uint8_t k = 1; k <= count; k++) {
+			uint8_t data = transfer.data[i + k];
+
+			for (uint8_t b = 0; b < 8; b++) {
+				emit(true, dioLow);
+				dioLow = !(data & 0x01);
+				emit(true, dioLow);
+				emit(false, dioLow);
+				data >>= 1;
+			}
+
+			// ACK: DIO liberado, amostrado com o clock alto
+			emit(true, dioLow);
+			emit(true, false);
+			emit(false, false);
+			ackSlot[acks++] = steps - 1;
+			dioLow = false;
+		}
+
+		// Stop: DIO baixo, clock sobe e depois o DIO sobe
+		emit(true, false);
+		emit(true, true);
+		emit(false, true);
+		emit(false, false);
+	}
+
+	return steps;
+}
+
+void TM1637DmaBus::start(uint16_t count)
+{
+	dma_transfer_config_t config;
+
+	DMA_PrepareTransfer(&config, wave, 1, (void *)laneDDR, 1, count, kDMA_MemoryToPeripheral);
+	DMA_SubmitTransfer(&dmaHandle, &config, kDMA_EnableInterrupt);
+
+	if (ack == ackSample) {
+		dma_transfer_config_t captureConfig;
+		dma_channel_link_config_t link = { kDMA_ChannelLinkChannel1, captureChannel, 0 };
+
+		// O canal de captura só é servido pela ligação após cada passo
+		DMA_PrepareTransfer(&captureConfig, (void *)lanePDIR, 1, capture, 1, count,
+				kDMA_PeripheralToMemory);
+		DMA_ResetChannel(DMA0, captureChannel);
+		DMA_SetTransferConfig(DMA0, captureChannel, &captureConfig);
+		DMA_SetChannelLinkConfig(DMA0, dmaChannel, &link);
+	}
+
+	DMA_StartTransfer(&dmaHandle);
+	PIT_StartTimer(PIT, (pit_chnl_t)dmaChannel);
+}
@@ -0,0 +1,146 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Transmissão para o TM1637 por DMA de formas de onda no GPIO.
+ *
+ * @file        TM1637DmaBus.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637DMABUS__
+#define __TM1637DMABUS__
+
+#include <inttypes.h>
+#include "fsl_dma.h"
+#include "mkl_DevGPIO.h"
+#include "Callback.h"
+#include "TM1637Bus.h"
+
+// Passos da forma de onda por bit: clock baixo, dado, clock alto
+#define TM1637_DMA_STEPS_PER_BIT 3
+
+// Tamanho da tabela: 27 passos por byte, mais start e stop de cada comando
+#define TM1637_DMA_WAVE_SIZE \
+	(TM1637_TRANSFER_SIZE * 9 * TM1637_DMA_STEPS_PER_BIT + (TM1637_TRANSFER_SIZE / 2) * 5)
+
+/*!
+ * Tratamento dos bits de ACK do TM1637
+ */
+enum tm1637_AckPolicy : uint8_t {
+	ackIgnore,		// Nenhuma amostragem, apenas um canal de DMA
+	ackSample		// Um canal ligado copia o PDIR a cada passo
+};
+
+/*!
+ *  @class    TM1637DmaBus
+ *
+ *  @brief    Barramento do TM1637 que transmite por DMA, sem uso do núcleo.
+ *
+ *  @details  Cada transferência é compilada em uma tabela de valores do PDDR
+ *            (um por passo de 1/3 de bit), que o canal de DMA escreve no GPIO
+ *            a cada disparo periódico do canal de mesmo número do PIT. O núcleo
+ *            só compila a tabela e trata a interrupção de fim de transferência.
+ *
+ *            Os pinos de clock e dados devem estar na mesma porta e no mesmo
+ *            byte do registrador (por exemplo PTA1 e PTA2): o DMA escreve
+ *            apenas esse byte do PDDR. Os demais pinos desse byte não devem
+ *            mudar de direção durante uma transferência, pois a tabela carrega a
+ *            direção que tinham no momento da compilação.
+ *
+ *            Os canais de DMA 0 e 1 são os únicos disparados pelo PIT; o canal
+ *            escolhido reserva também o canal de mesmo número do PIT. Com
+ *            ackSample, o canal de captura (2 por padrão) é ligado ao
+ *            principal para amostrar o PDIR e fica reservado durante as
+ *            transferências. Outros usuários do DMA, como mkl_DevGPIOCapture,
+ *            devem usar canais fora desse par.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              TM1637DmaBus dmaBus(gpio_PTA1, gpio_PTA2);
+ *              dmaBus.begin(freq250kHz);
+ *              display.attachBus(&dmaBus);
+ */
+class TM1637DmaBus : public TM1637Bus, public Callback {
+
+public:
+	TM1637DmaBus(gpio_Pin pinClk, gpio_Pin pinDIO, uint8_t channel = 0,
+			tm1637_AckPolicy ackPolicy = ackIgnore, uint8_t captureChannel = 2);
+
+/*!
+ * Configura DMA, DMAMUX e PIT
+ *
+ * @return false se os pinos não estiverem no mesmo byte da mesma porta, se o
+ *         canal não puder ser disparado pelo PIT ou se, com ackSample, o canal
+ *         de captura coincidir com o principal ou não existir
+ */
+	bool begin(busFrequency frequency = freq250kHz);
+
+/*!
+ * Compila e inicia a transferência, ou a guarda se o DMA estiver ocupado
+ *
+ * Há espaço para uma transferência pendente, compilada na interrupção de fim
+ * da transferência atual.
+ */
+	bool submit(const tm1637_Transfer &transfer);
+
+	bool isBusy() const;
+
+/*!
+ * Número de bytes sem ACK desde a criação (somente com ackSample)
+ */
+	uint32_t getNackCount() const;
+
+/*!
+ * Trata o fim da transferência; chamado pela interrupção do canal de DMA
+ */
+	void handleComplete();
+
+protected:
+	uint16_t compile(const tm1637_Transfer &transfer);
+	void start(uint16_t count);
+	void emit(bool clkLow, bool dioLow);
+
+private:
+	uint8_t clkMask;
+	uint8_t dioMask;
+	uint8_t otherMask;
+	volatile uint8_t *laneDDR;
+	volatile uint8_t *lanePDIR;
+	uint8_t dmaChannel;
+	uint8_t captureChannel;
+	tm1637_AckPolicy ack;
+	dma_handle_t dmaHandle;
+
+/*!
+ * Tabela da forma de onda, amostras do PDIR e posições dos ACKs
+ */
+	uint8_t wave[TM1637_DMA_WAVE_SIZE];
+	uint8_t capture[TM1637_DMA_WAVE_SIZE];
+	uint16_t ackSlot[TM1637_TRANSFER_SIZE];
+	uint16_t steps = 0;
+	uint8_t acks = 0;
+	uint8_t base = 0;
+
+	tm1637_Transfer pending;
+	volatile bool hasPending = false;
+	volatile bool running = false;
+	uint32_t nacks = 0;
+};
+
+#endif // __TM1637DMABUS__
@@ -0,0 +1,51 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Fonte ASCII de 7 segmentos e codificação de texto.
+ *
+ * @file        TM1637Font.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637Font.h"
+
+const uint8_t tm1637_font[TM1637_FONT_SIZE] = { TM1637_FONT_GLYPHS };
+
+uint8_t tm1637_encodeText(const char text[], uint8_t segments[], uint8_t maxLength)
+{
+	uint8_t k = 0;
+	char previous = 0;
+
+	// Uma consulta à tabela por caractere; o ponto só altera o dígito anterior
+	for (; *text != 0; previous = *text++) {
+		uint8_t index = (uint8_t)(*text - TM1637_FONT_FIRST);
+
+		if (*text == '.' && k != 0 && previous != '.' && !(segments[k - 1] & 0x80)) {
+			segments[k - 1] |= 0x80;
+			continue;
+		}
+
+		if (k == maxLength)
+			break;
+
+		segments[k++] = (index < TM1637_FONT_SIZE) ? tm1637_font[index] : 0;
+	}
+
+	return k;
+}
@@ -0,0 +1,268 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Fonte ASCII de 7 segmentos e codificação de texto.
+ *
+ * @file        TM1637Font.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637FONT__
+#define __TM1637FONT__
+
+#include <inttypes.h>
+
+// Primeiro caractere da fonte e número de caracteres (ASCII imprimível)
+#define TM1637_FONT_FIRST  0x20
+#define TM1637_FONT_SIZE   96
+
+//
+//      A
+//     ---
+//  F |   | B
+//     -G-
+//  E |   | C
+//     ---
+//      D
+//
+/*!
+ * Lista dos glifos, para montar a tabela de tempo de execução (tm1637_font, em
+ * TM1637Font.cpp) e a de tempo de compilação (tm1637_glyph) a partir dos
+ * mesmos dados
+ */
+#define TM1637_FONT_GLYPHS \
+	/* XGFEDCBA */ \
+	0b00000000, /* (espaço) */ \
+	0b10000110, /* ! */ \
+	0b00100010, /* " */ \
+	0b01111110, /* # */ \
+	0b01101101, /* $ */ \
+	0b11010010, /* % */ \
+	0b01000110, /* & */ \
+	0b00100000, /* ' */ \
+	0b00101001, /* ( */ \
+	0b00001011, /* ) */ \
+	0b00100001, /* * */ \
+	0b01110000, /* + */ \
+	0b00010000, /* , */ \
+	0b01000000, /* - */ \
+	0b10000000, /* . */ \
+	0b01010010, /* / */ \
+	0b00111111, /* 0 */ \
+	0b00000110, /* 1 */ \
+	0b01011011, /* 2 */ \
+	0b01001111, /* 3 */ \
+	0b01100110, /* 4 */ \
+	0b01101101, /* 5 */ \
+	0b01111101, /* 6 */ \
+	0b00000111, /* 7 */ \
+	0b01111111, /* 8 */ \
+	0b01101111, /* 9 */ \
+	0b00001001, /* : */ \
+	0b00001101, /* ; */ \
+	0b01100001, /* < */ \
+	0b01001000, /* = */ \
+	0b01000011, /* > */ \
+	0b11010011, /* ? */ \
+	0b01011111, /* @ */ \
+	0b01110111, /* A */ \
+	0b01111100, /* B */ \
+	0b00111001, /* C */ \
+	0b01011110, /* D */ \
+	0b01111001, /* E */ \
+	0b01110001, /* F */ \
+	0b00111101, /* G */ \
+	0b01110110, /* H */ \
+	0b00110000, /* I */ \
+	0b00011110, /* J */ \
+	0b01110101, /* K */ \
+	0b00111000, /* L */ \
+	0b00010101, /* M */ \
+	0b00110111, /* N */ \
+	0b00111111, /* O */ \
+	0b01110011, /* P */ \
+	0b01101011, /* Q */ \
+	0b00110011, /* R */ \
+	0b01101101, /* S */ \
+	0b01111000, /* T */ \
+	0b00111110, /* U */ \
+	0b00111110, /* V */ \
+	0b00101010, /* W */ \
+	0b01110110, /* X */ \
+	0b01101110, /* Y */ \
+	0b01011011, /* Z */ \
+	0b00111001, /* [ */ \
+	0b01100100, /* barra invertida */ \
+	0b00001111, /* ] */ \
+	0b00100011, /* ^ */ \
+	0b00001000, /* _ */ \
+	0b00000010, /* ` */ \
+	0b01011111, /* a */ \
+	0b01111100, /* b */ \
+	0b01011000, /* c */ \
+	0b01011110, /* d */ \
+	0b01111011, /* e */ \
+	0b01110001, /* f */ \
+	0b01101111, /* g */ \
+	0b01110100, /* h */ \
+	0b00010000, /* i */ \
+	0b00001100, /* j */ \
+	0b01110101, /* k */ \
+	0b00110000, /* l */ \
+	0b00010100, /* m */ \
+	0b01010100, /* n */ \
+	0b01011100, /* o */ \
+	0b01110011, /* p */ \
+	0b01100111, /* q */ \
+	0b01010000, /* r */ \
+	0b01101101, /* s */ \
+	0b01111000, /* t */ \
+	0b00011100, /* u */ \
+	0b00011100, /* v */ \
+	0b00010100, /* w */ \
+	0b01110110, /* x */ \
+	0b01101110, /* y */ \
+	0b01011011, /* z */ \
+	0b01000110, /* { */ \
+	0b00110000, /* | */ \
+	0b01110000, /* } */ \
+	0b00000001, /* ~ */ \
+	0b00000000  /* DEL */
+
+/*!
+ * Tabela da fonte, definida uma única vez em TM1637Font.cpp
+ */
+extern const uint8_t tm1637_font[TM1637_FONT_SIZE];
+
+/*!
+ * Cópia da tabela para avaliação em tempo de compilação
+ */
+struct tm1637_FontGlyphs {
+	uint8_t glyphs[TM1637_FONT_SIZE];
+};
+
+/*!
+ * Código de 7 segmentos de um caractere (0 fora do ASCII imprimível), para
+ * uso em tempo de compilação (tm1637_encode, _seg); em tempo de execução,
+ * tm1637_encodeChar() consulta a tabela única da flash
+ */
+constexpr uint8_t tm1637_glyph(char c)
+{
+	return ((uint8_t)(c - TM1637_FONT_FIRST) < TM1637_FONT_SIZE)
+			? tm1637_FontGlyphs{ { TM1637_FONT_GLYPHS } }.glyphs[(uint8_t)(c - TM1637_FONT_FIRST)]
+			: 0;
+}
+
+/*!
+ * Converte um caractere no seu código de 7 segmentos (0 fora do ASCII imprimível)
+ */
+inline uint8_t tm1637_encodeChar(char c)
+{
+	return ((uint8_t)(c - TM1637_FONT_FIRST) < TM1637_FONT_SIZE)
+			? tm1637_font[(uint8_t)(c - TM1637_FONT_FIRST)] : 0;
+}
+
+/*!
+ * Indica se o caractere é um ponto que se junta ao dígito anterior
+ *
+ * O ponto ocupa o segmento DP do dígito anterior, exceto no início do texto,
+ * após outro ponto ou após um caractere que já acende o DP.
+ */
+constexpr bool tm1637_isFoldedDot(const char text[], uint8_t i)
+{
+	return text[i] == '.' && i != 0 && text[i - 1] != '.'
+			&& !(tm1637_glyph(text[i - 1]) & 0x80);
+}
+
+/*!
+ * Número de dígitos ocupados pelo texto, com os pontos já juntados
+ */
+constexpr uint8_t tm1637_textLength(const char text[])
+{
+	uint8_t length = 0;
+
+	for (uint8_t i = 0; text[i] != 0; i++) {
+		if (!tm1637_isFoldedDot(text, i))
+			length++;
+	}
+
+	return length;
+}
+
+/*!
+ * Texto já convertido em segmentos, um byte por dígito
+ */
+template<uint8_t N>
+struct tm1637_Text {
+	static constexpr uint8_t length = N;
+	uint8_t segments[N];
+};
+
+/*!
+ * Converte o texto em segmentos; em um contexto constexpr o resultado é
+ * calculado pelo compilador e gravado na flash
+ */
+template<uint8_t N>
+constexpr tm1637_Text<N> tm1637_encode(const char text[])
+{
+	tm1637_Text<N> result = {};
+	uint8_t k = 0;
+
+	for (uint8_t i = 0; text[i] != 0 && k <= N; i++) {
+		if (tm1637_isFoldedDot(text, i))
+			result.segments[k - 1] |= 0x80;
+		else if (k < N)
+			result.segments[k++] = tm1637_glyph(text[i]);
+		else
+			break;
+	}
+
+	return result;
+}
+
+template<char... C>
+constexpr uint8_t tm1637_packLength()
+{
+	const char text[] = { C..., 0 };
+	return tm1637_textLength(text);
+}
+
+/*!
+ * Literal de texto em segmentos, calculado em tempo de compilação
+ *
+ * 	constexpr auto err = "Err"_seg;
+ * 	display.writeText(err);
+ */
+template<typename T, T... C>
+constexpr tm1637_Text<tm1637_packLength<C...>()> operator"" _seg()
+{
+	const char text[] = { C..., 0 };
+	return tm1637_encode<tm1637_packLength<C...>()>(text);
+}
+
+/*!
+ * Converte um texto em tempo de execução, juntando os pontos ao dígito anterior
+ *
+ * @param text O texto terminado em zero
+ * @param segments Recebe até @ref maxLength dígitos
+ * @return O número de dígitos escritos
+ */
+uint8_t tm1637_encodeText(const char text[], uint8_t segments[], uint8_t maxLength);
+
+#endif // __TM1637FONT__
@@ -0,0 +1,215 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Leitura periódica e com debounce do teclado do TM1637.
+ *
+ * @file        TM1637Keypad.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637Keypad.h"
+#include "fsl_lptmr.h"
+#include "mkl_CycleCounter.h"
+
+static mkl_CycleCounter scanCounter;
+
+/*!
+ * Teclado associado ao LPTMR0, para o tratador de interrupção
+ */
+static TM1637Keypad *lptmrInstance = nullptr;
+
+TM1637Keypad::TM1637Keypad(TM1637Core &display) : display(display)
+{
+}
+
+void TM1637Keypad::begin(uint16_t periodMs)
+{
+	lptmr_config_t config;
+
+	period = (periodMs != 0) ? periodMs : 1;
+
+	// Configuração padrão: modo temporizador com o LPO de 1 kHz, sem prescaler
+	LPTMR_GetDefaultConfig(&config);
+	LPTMR_Init(LPTMR0, &config);
+	LPTMR_SetTimerPeriod(LPTMR0, period);
+
+	lptmrInstance = this;
+	LPTMR_EnableInterrupts(LPTMR0, kLPTMR_TimerInterruptEnable);
+	NVIC_EnableIRQ(LPTMR0_IRQn);
+	LPTMR_StartTimer(LPTMR0);
+}
+
+void TM1637Keypad::end()
+{
+	LPTMR_StopTimer(LPTMR0);
+	NVIC_DisableIRQ(LPTMR0_IRQn);
+	lptmrInstance = nullptr;
+}
+
+void TM1637Keypad::setDebounce(uint8_t scans)
+{
+	debounceScans = (scans != 0) ? scans : 1;
+}
+
+void TM1637Keypad::setRepeat(uint16_t delayScans, uint16_t intervalScans)
+{
+	repeatDelay = delayScans;
+	repeatInterval = (intervalScans != 0) ? intervalScans : 1;
+}
+
+bool TM1637Keypad::getEvent(tm1637_KeyEvent &event)
+{
+	if (tail == head)
+		return false;
+
+	// As barreiras impedem o compilador de ler a posição antes de head, ou de
+	// liberá-la (tail) antes de terminar a cópia
+	__DMB();
+	event = queue[tail];
+	__DMB();
+	tail = (tail + 1) & (TM1637_KEY_QUEUE_DEPTH - 1);
+
+	return true;
+}
+
+uint8_t TM1637Keypad::decodeKey(uint8_t code)
+{
+	uint8_t row;
+
+	if (code == TM1637_NO_KEY)
+		return TM1637_NO_KEY;
+
+	// Os 4 bits baixos indicam a linha (K1 ou K2) e os 3 altos, invertidos e
+	// com a ordem dos bits trocada, a coluna SG1 a SG8
+	if ((code & 0x0F) == 0x0F)
+		row = 0;
+	else if ((code & 0x0F) == 0x07)
+		row = 8;
+	else
+		return TM1637_NO_KEY;
+
+	uint8_t sg = ~(code >> 5) & 0x07;
+	sg = ((sg & 0x01) << 2) | (sg & 0x02) | ((sg & 0x04) >> 2);
+
+	return row + sg;
+}
+
+void TM1637Keypad::scan()
+{
+	uint8_t code;
+
+	scanCounter.start();
+
+	if (!display.tryReadKeys(code)) {
+		stats.skipped++;
+		return;
+	}
+
+	uint32_t cycles = scanCounter.elapsed();
+	stats.scans++;
+	stats.scanCycles += cycles;
+	if (cycles > stats.maxScanCycles)
+		stats.maxScanCycles = cycles;
+
+	debounce(decodeKey(code));
+}
+
+void TM1637Keypad::debounce(uint8_t key)
+{
+	if (key != candidate) {
+		candidate = key;
+		count = 1;
+	} else if (count < debounceScans) {
+		count++;
+	}
+
+	if (count < debounceScans)
+		return;
+
+	if (candidate != stable) {
+		if (stable != TM1637_NO_KEY)
+			push(stable, keyRelease);
+
+		stable = candidate;
+		held = 0;
+
+		if (stable != TM1637_NO_KEY)
+			push(stable, keyPress);
+		return;
+	}
+
+	if (stable == TM1637_NO_KEY || repeatDelay == 0)
+		return;
+
+	if (++held >= repeatDelay) {
+		push(stable, keyRepeat);
+		held = (repeatInterval < repeatDelay) ? repeatDelay - repeatInterval : 0;
+	}
+}
+
+void TM1637Keypad::push(uint8_t key, tm1637_KeyEventType type)
+{
+	uint8_t next = (head + 1) & (TM1637_KEY_QUEUE_DEPTH - 1);
+
+	if (next == tail) {
+		stats.overflows++;
+		return;
+	}
+
+	queue[head].key = key;
+	queue[head].type = type;
+
+	// O evento precisa estar gravado antes de head o publicar
+	__DMB();
+	head = next;
+}
+
+tm1637_KeypadStats TM1637Keypad::getStats() const
+{
+	return stats;
+}
+
+void TM1637Keypad::resetStats()
+{
+	stats.scans = 0;
+	stats.skipped = 0;
+	stats.scanCycles = 0;
+	stats.maxScanCycles = 0;
+	stats.overflows = 0;
+}
+
+tm1637_KeypadLoad TM1637Keypad::getLoad() const
+{
+	tm1637_KeypadLoad load;
+
+	load.scanRate = 1000 / period;
+	load.cyclesPerScan = (stats.scans != 0) ? stats.scanCycles / stats.scans : 0;
+	load.cpuSharePermille = (uint32_t)((uint64_t)load.cyclesPerScan * load.scanRate
+			* 1000 / SystemCoreClock);
+
+	return load;
+}
+
+extern "C" void LPTMR0_IRQHandler(void)
+{
+	LPTMR_ClearStatusFlags(LPTMR0, kLPTMR_TimerCompareFlag);
+
+	if (lptmrInstance != nullptr)
+		lptmrInstance->scan();
+}
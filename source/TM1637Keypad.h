@@ -0,0 +1,187 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Leitura periódica e com debounce do teclado do TM1637.
+ *
+ * @file        TM1637Keypad.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637KEYPAD__
+#define __TM1637KEYPAD__
+
+#include <inttypes.h>
+#include "TM1637Display.h"
+
+// Número de eventos na fila (potência de 2)
+#define TM1637_KEY_QUEUE_DEPTH 16
+
+// Código de tecla quando nenhuma está pressionada
+#define TM1637_NO_KEY 0xFF
+
+enum tm1637_KeyEventType : uint8_t {
+	keyPress,
+	keyRelease,
+	keyRepeat
+};
+
+/*!
+ * Evento de teclado: tecla 0 a 7 para K1/SG1 a K1/SG8, 8 a 15 para K2/SG1 a K2/SG8
+ */
+struct tm1637_KeyEvent {
+	uint8_t key;
+	tm1637_KeyEventType type;
+};
+
+/*!
+ * Estatísticas da varredura
+ */
+struct tm1637_KeypadStats {
+	uint32_t scans;			// Leituras feitas do TM1637
+	uint32_t skipped;		// Varreduras adiadas por uma escrita em andamento
+	uint32_t scanCycles;	// Ciclos gastos nas leituras
+	uint32_t maxScanCycles;	// Pior caso de uma única leitura
+	uint32_t overflows;		// Eventos perdidos com a fila cheia
+};
+
+/*!
+ * Carga da varredura, calculada a partir das estatísticas
+ */
+struct tm1637_KeypadLoad {
+	uint32_t scanRate;			// Varreduras por segundo configuradas
+	uint32_t cyclesPerScan;		// Custo médio de uma leitura
+	uint32_t cpuSharePermille;	// Fração do núcleo gasta na varredura, em milésimos
+};
+
+/*!
+ *  @class    TM1637Keypad
+ *
+ *  @brief    Varredura periódica do teclado do TM1637 com fila de eventos.
+ *
+ *  @details  O LPTMR0, no clock de 1 kHz do LPO, dispara uma leitura (comando
+ *            0x42) a cada período. O debounce conta varreduras consecutivas
+ *            iguais, sem nenhum atraso bloqueante, e os eventos de pressão,
+ *            liberação e repetição vão para uma fila sem travas: a interrupção
+ *            só escreve head e getEvent() só escreve tail.
+ *
+ *            A leitura usa TM1637Core::tryReadKeys(), então uma varredura que
+ *            encontra uma escrita em andamento no laço principal ou no
+ *            barramento anexado é adiada para o período seguinte, sem atrasar
+ *            a atualização do display.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              TM1637Keypad keypad(display);
+ *              keypad.begin(10);
+ *              tm1637_KeyEvent event;
+ *              while (keypad.getEvent(event)) { ... }
+ */
+class TM1637Keypad {
+
+public:
+	TM1637Keypad(TM1637Core &display);
+
+/*!
+ * Configura o LPTMR0 e inicia a varredura
+ *
+ * Apenas um teclado pode estar ativo, pois o LPTMR0 é único.
+ *
+ * @param periodMs O intervalo entre varreduras, em milissegundos
+ */
+	void begin(uint16_t periodMs = 10);
+
+/*!
+ * Para a varredura
+ */
+	void end();
+
+/*!
+ * Define quantas varreduras iguais confirmam uma mudança de tecla
+ */
+	void setDebounce(uint8_t scans);
+
+/*!
+ * Define a repetição de uma tecla mantida pressionada
+ *
+ * @param delayScans Varreduras, após a pressão, até a primeira repetição (0 desabilita)
+ * @param intervalScans Varreduras entre repetições seguintes
+ */
+	void setRepeat(uint16_t delayScans, uint16_t intervalScans);
+
+/*!
+ * Retira o evento mais antigo da fila
+ *
+ * @return false se a fila estiver vazia
+ */
+	bool getEvent(tm1637_KeyEvent &event);
+
+/*!
+ * Converte o byte lido do TM1637 no índice da tecla, ou TM1637_NO_KEY
+ */
+	static uint8_t decodeKey(uint8_t code);
+
+/*!
+ * Executa uma varredura; chamado por LPTMR0_IRQHandler
+ */
+	void scan();
+
+/*!
+ * Retorna as estatísticas acumuladas desde a última chamada de resetStats()
+ */
+	tm1637_KeypadStats getStats() const;
+
+	void resetStats();
+
+/*!
+ * Calcula a taxa de varredura e o custo de CPU a partir das estatísticas
+ */
+	tm1637_KeypadLoad getLoad() const;
+
+protected:
+	void debounce(uint8_t key);
+	void push(uint8_t key, tm1637_KeyEventType type);
+
+private:
+	TM1637Core &display;
+	uint16_t period = 10;
+
+/*!
+ * Estado do debounce: tecla candidata, varreduras em que ela se repetiu e
+ * tecla confirmada
+ */
+	uint8_t candidate = TM1637_NO_KEY;
+	uint8_t count = 0;
+	uint8_t stable = TM1637_NO_KEY;
+	uint8_t debounceScans = 2;
+
+	uint16_t held = 0;
+	uint16_t repeatDelay = 50;
+	uint16_t repeatInterval = 10;
+
+/*!
+ * Fila de eventos: head é escrito pela interrupção e tail pelo laço principal
+ */
+	tm1637_KeyEvent queue[TM1637_KEY_QUEUE_DEPTH];
+	volatile uint8_t head = 0;
+	volatile uint8_t tail = 0;
+
+	tm1637_KeypadStats stats = { 0, 0, 0, 0, 0 };
+};
+
+#endif // __TM1637KEYPAD__
@@ -0,0 +1,162 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Letreiro rolante no TM1637 avançado pelo PIT.
+ *
+ * @file        TM1637Marquee.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637Marquee.h"
+#include "fsl_clock.h"
+
+TM1637Marquee::TM1637Marquee(TM1637Core &display, pit_chnl_t channel)
+		: display(display)
+{
+	pitChannel = channel;
+}
+
+bool TM1637Marquee::setText(const char text[])
+{
+	stop();
+
+	// Um dígito além do limite, no espaço das posições em branco, indica que a
+	// mensagem não coube
+	uint8_t encoded = tm1637_encodeText(text, ring, TM1637_MARQUEE_MAX + 1);
+	setSegments(ring, encoded);
+
+	return encoded <= TM1637_MARQUEE_MAX;
+}
+
+void TM1637Marquee::setSegments(const uint8_t segments[], uint8_t length)
+{
+	stop();
+
+	if (length > TM1637_MARQUEE_MAX)
+		length = TM1637_MARQUEE_MAX;
+
+	// Em setText() a mensagem já foi convertida diretamente no anel
+	if (segments != ring) {
+		for (uint8_t k = 0; k < length; k++)
+			ring[k] = segments[k];
+	}
+
+	this->length = length;
+}
+
+void TM1637Marquee::setSpeed(uint16_t stepMs)
+{
+	this->stepMs = (stepMs != 0) ? stepMs : 1;
+}
+
+void TM1637Marquee::setPause(uint16_t pauseMs)
+{
+	this->pauseMs = pauseMs;
+}
+
+void TM1637Marquee::setLoops(uint8_t loops)
+{
+	this->loops = loops;
+}
+
+void TM1637Marquee::start()
+{
+	pit_config_t config;
+
+	stop();
+
+	// As posições em branco no fim do anel fazem a mensagem sair pela esquerda
+	// e entrar de novo pela direita
+	width = display.getDigits();
+	for (uint8_t k = 0; k < width; k++)
+		ring[length + k] = 0;
+	ringLength = length + width;
+
+	pauseTicks = pauseMs / stepMs;
+	offset = length;
+	pass = 0;
+	hold = 0;
+
+	PIT_GetDefaultConfig(&config);
+	PIT_Init(PIT, &config);
+	PIT_SetTimerPeriod(PIT, pitChannel, CLOCK_GetBusClkFreq() / 1000 * stepMs - 1);
+	tm1637_attachPit(pitChannel, this);
+
+	running = true;
+	PIT_StartTimer(PIT, pitChannel);
+}
+
+void TM1637Marquee::stop()
+{
+	if (!running)
+		return;
+
+	PIT_StopTimer(PIT, pitChannel);
+	running = false;
+}
+
+bool TM1637Marquee::isRunning() const
+{
+	return running;
+}
+
+void TM1637Marquee::handleInterrupt()
+{
+	PIT_ClearStatusFlags(PIT, pitChannel, kPIT_TimerFlag);
+
+	if (!running)
+		return;
+
+	if (hold != 0) {
+		hold--;
+		return;
+	}
+
+	if (!display.isIdle())
+		return;
+
+	if (++offset == ringLength)
+		offset = 0;
+
+	show();
+
+	// Mensagem de volta ao início do anel: o display está em branco
+	if (offset == length && loops != 0 && ++pass >= loops) {
+		stop();
+		return;
+	}
+
+	if (offset == 0 || (length > width && offset == length - width))
+		hold = pauseTicks;
+}
+
+void TM1637Marquee::show()
+{
+	uint8_t frame[TM1637_MAX_DIGITS];
+	uint8_t index = offset;
+
+	// Sem divisão: o índice volta ao início do anel por comparação
+	for (uint8_t k = 0; k < width; k++) {
+		frame[k] = ring[index];
+		if (++index == ringLength)
+			index = 0;
+	}
+
+	display.setSegments(frame, first, (numLength)width);
+}
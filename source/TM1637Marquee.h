@@ -0,0 +1,144 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Letreiro rolante no TM1637 avançado pelo PIT.
+ *
+ * @file        TM1637Marquee.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637MARQUEE__
+#define __TM1637MARQUEE__
+
+#include <inttypes.h>
+#include "fsl_pit.h"
+#include "TM1637Display.h"
+#include "TM1637Pit.h"
+
+// Número máximo de dígitos de uma mensagem, depois da conversão para segmentos
+#define TM1637_MARQUEE_MAX 64
+
+/*!
+ *  @class    TM1637Marquee
+ *
+ *  @brief    Letreiro que rola uma mensagem maior que o display.
+ *
+ *  @details  A mensagem é convertida uma única vez em um anel de segmentos,
+ *            seguido de uma posição em branco por dígito do display. A cada
+ *            tick do canal do PIT a janela avança um dígito e é passada a
+ *            setSegments(), que envia apenas os dígitos alterados. O laço
+ *            principal só configura o letreiro; nenhuma conversão ou espera
+ *            acontece durante a rolagem.
+ *
+ *            Se o display estiver ocupado no tick (escrita no laço principal,
+ *            leitura de teclas ou barramento anexado em uso), o passo é
+ *            adiado para o tick seguinte.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              TM1637Marquee marquee(display);
+ *              marquee.setText("HELLO FRDM-KL25Z");
+ *              marquee.setSpeed(250);
+ *              marquee.setPause(1000);
+ *              marquee.start();
+ */
+class TM1637Marquee : public TM1637PitHandler {
+
+public:
+	TM1637Marquee(TM1637Core &display, pit_chnl_t channel = kPIT_Chnl_1);
+
+/*!
+ * Converte e guarda a mensagem, parando a rolagem em andamento
+ *
+ * @return false se a mensagem foi truncada em TM1637_MARQUEE_MAX dígitos
+ */
+	bool setText(const char text[]);
+
+//! @overload Mensagem já convertida em tempo de compilação
+	template<uint8_t N>
+	void setText(const tm1637_Text<N> &text)
+	{
+		setSegments(text.segments, N);
+	}
+
+/*!
+ * Guarda uma mensagem já em segmentos, parando a rolagem em andamento
+ */
+	void setSegments(const uint8_t segments[], uint8_t length);
+
+/*!
+ * Define o intervalo entre passos da rolagem, aplicado no próximo start()
+ */
+	void setSpeed(uint16_t stepMs);
+
+/*!
+ * Define a pausa com a mensagem alinhada à esquerda e, se ela for maior que o
+ * display, com o fim alinhado à direita
+ */
+	void setPause(uint16_t pauseMs);
+
+/*!
+ * Define o número de passagens completas antes de parar (0 = sem fim)
+ */
+	void setLoops(uint8_t loops);
+
+/*!
+ * Inicia a rolagem, com a mensagem entrando pela direita no primeiro passo
+ */
+	void start();
+
+	void stop();
+
+	bool isRunning() const;
+
+/*!
+ * Avança um passo; chamado por PIT_IRQHandler via tm1637_attachPit()
+ */
+	void handleInterrupt();
+
+protected:
+	void show();
+
+private:
+	TM1637Core &display;
+	pit_chnl_t pitChannel;
+
+/*!
+ * Mensagem em segmentos seguida de um dígito em branco por posição do display
+ */
+	uint8_t ring[TM1637_MARQUEE_MAX + TM1637_MAX_DIGITS];
+	uint8_t length = 0;
+	uint8_t ringLength = 0;
+	uint8_t width = 0;
+
+	uint16_t stepMs = 300;
+	uint16_t pauseTicks = 0;
+	uint16_t pauseMs = 0;
+	uint8_t loops = 0;
+
+/*!
+ * Estado da rolagem, alterado pela interrupção
+ */
+	volatile bool running = false;
+	uint8_t offset = 0;
+	uint8_t pass = 0;
+	uint16_t hold = 0;
+};
+
+#endif // __TM1637MARQUEE__
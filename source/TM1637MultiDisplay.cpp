@@ -0,0 +1,242 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Vários displays TM1637 atualizados em paralelo em uma porta.
+ *
+ * @file        TM1637MultiDisplay.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637MultiDisplay.h"
+
+#define TM1637_I2C_COMM1    0x40
+#define TM1637_I2C_COMM2    0xC0
+#define TM1637_I2C_COMM3    0x80
+
+TM1637MultiDisplay::TM1637MultiDisplay(gpio_Pin pinClk, const gpio_Pin pinsDIO[],
+		uint8_t count, gpio_AccessPath accessPath)
+{
+	clkMask = mkl_DevGPIOPort::pinMask(pinClk);
+	dioAll = 0;
+
+	for (uint8_t m = 0; m < count && this->count < TM1637_MULTI_MAX; m++) {
+		if ((pinsDIO[m] >> 8) != (pinClk >> 8))
+			continue;
+
+		dioMask[this->count++] = mkl_DevGPIOPort::pinMask(pinsDIO[m]);
+		dioAll |= mkl_DevGPIOPort::pinMask(pinsDIO[m]);
+	}
+
+	port = mkl_DevGPIOPort((gpio_Name)(pinClk & 0xFF00), clkMask | dioAll, accessPath);
+
+	for (uint8_t m = 0; m < TM1637_MULTI_MAX; m++)
+		for (uint8_t k = 0; k < TM1637_MAX_DIGITS; k++)
+			shadow[m][k] = 0;
+
+	// A RAM do TM1637 é indefinida ao ligar: o primeiro update() envia todas
+	// as posições, mesmo as que continuam em branco
+	dirty = (1 << TM1637_MAX_DIGITS) - 1;
+}
+
+uint8_t TM1637MultiDisplay::getCount() const
+{
+	return count;
+}
+
+void TM1637MultiDisplay::setBrightness(uint8_t _brightness, bool on)
+{
+	brightness = (_brightness & 0x7) | (on? 0x08 : 0x00);
+}
+
+void TM1637MultiDisplay::setSegments(uint8_t module, const uint8_t segments[],
+		digitPosition pos, numLength length)
+{
+	if (module >= count)
+		return;
+
+	for (uint8_t k = 0; k < length && pos + k < TM1637_MAX_DIGITS; k++) {
+		if (shadow[module][pos + k] == segments[k])
+			continue;
+
+		shadow[module][pos + k] = segments[k];
+		dirty |= 1 << (pos + k);
+	}
+}
+
+void TM1637MultiDisplay::clear()
+{
+	uint8_t blank[TM1637_MAX_DIGITS] = { 0, 0, 0, 0, 0, 0 };
+
+	for (uint8_t m = 0; m < count; m++)
+		setSegments(m, blank, first, six);
+}
+
+void TM1637MultiDisplay::update()
+{
+	uint8_t control = TM1637_I2C_COMM3 + (brightness & 0x0f);
+
+	nackMask = 0;
+
+	if (timing.calibratedClock != SystemCoreClock)
+		calibrateTiming();
+
+	if (dirty != 0) {
+		uint8_t low = 0;
+		uint8_t high = TM1637_MAX_DIGITS - 1;
+
+		while (!(dirty & (1 << low)))
+			low++;
+		while (!(dirty & (1 << high)))
+			high--;
+
+		if (!dataCommandSent) {
+			start();
+			writeCommon(TM1637_I2C_COMM1);
+			stop();
+			dataCommandSent = true;
+		}
+
+		// Uma única sequência com auto incremento, do primeiro ao último
+		// dígito alterado em qualquer módulo
+		start();
+		writeCommon(TM1637_I2C_COMM2 + low);
+		for (uint8_t addr = low; addr <= high; addr++) {
+			uint8_t bytes[TM1637_MULTI_MAX];
+
+			for (uint8_t m = 0; m < count; m++)
+				bytes[m] = shadow[m][addr];
+			writeBytes(bytes);
+		}
+		stop();
+
+		dirty = 0;
+	}
+
+	if (control != lastControl) {
+		start();
+		writeCommon(control);
+		stop();
+		lastControl = control;
+	}
+}
+
+uint8_t TM1637MultiDisplay::getNackMask() const
+{
+	return nackMask;
+}
+
+void TM1637MultiDisplay::setBusFrequency(busFrequency frequency)
+{
+	timing.frequency = frequency;
+	timing.calibratedClock = 0;
+}
+
+void TM1637MultiDisplay::calibrateTiming()
+{
+	mkl_CycleCounter counter;
+
+	// Mede o custo de uma escrita do PDDR da porta com as linhas liberadas
+	timing.halfBitLoops = 0;
+	timing.holdLoops = 0;
+	counter.start();
+	for (uint8_t i = 0; i < 8; i++) {
+		port.writeDirection(0);
+		tm1637_busyWait(timing.halfBitLoops);
+	}
+
+	tm1637_setTiming(timing, counter.elapsed() / 8);
+}
+
+void TM1637MultiDisplay::start()
+{
+	// Todos os DIOs descem com o clock alto
+	lines = dioAll;
+	port.writeDirection(lines);
+	tm1637_busyWait(timing.halfBitLoops);
+}
+
+void TM1637MultiDisplay::stop()
+{
+	lines = clkMask | dioAll;
+	port.writeDirection(lines);
+	tm1637_busyWait(timing.halfBitLoops);
+	lines = dioAll;
+	port.writeDirection(lines);
+	tm1637_busyWait(timing.halfBitLoops);
+	lines = 0;
+	port.writeDirection(lines);
+	tm1637_busyWait(timing.halfBitLoops);
+}
+
+void TM1637MultiDisplay::writeBytes(const uint8_t bytes[])
+{
+	uint32_t data = lines & dioAll;
+
+	for (uint8_t bit = 0; bit < 8; bit++) {
+		uint32_t next = 0;
+
+		// Máscara dos DIOs que devem ficar em nível baixo neste bit
+		for (uint8_t m = 0; m < count; m++) {
+			if (!((bytes[m] >> bit) & 0x01))
+				next |= dioMask[m];
+		}
+
+		port.writeDirection(clkMask | data);
+		tm1637_busyWait(timing.holdLoops);
+
+		data = next;
+		port.writeDirection(clkMask | data);
+		tm1637_busyWait(timing.halfBitLoops);
+
+		port.writeDirection(data);
+		tm1637_busyWait(timing.halfBitLoops);
+	}
+
+	// ACK: todos os DIOs liberados e amostrados juntos com o clock alto
+	port.writeDirection(clkMask | data);
+	tm1637_busyWait(timing.holdLoops);
+	port.writeDirection(clkMask);
+	tm1637_busyWait(timing.halfBitLoops);
+
+	port.writeDirection(0);
+	tm1637_busyWait(timing.halfBitLoops);
+	uint32_t levels = port.readPort();
+
+	for (uint8_t m = 0; m < count; m++) {
+		if (levels & dioMask[m])
+			nackMask |= 1 << m;
+	}
+
+	// Os módulos que responderam mantêm o DIO baixo, como em TM1637Display
+	data = dioAll & ~levels;
+	port.writeDirection(data);
+	lines = clkMask | data;
+	port.writeDirection(lines);
+	tm1637_busyWait(timing.holdLoops);
+}
+
+void TM1637MultiDisplay::writeCommon(uint8_t b)
+{
+	uint8_t bytes[TM1637_MULTI_MAX];
+
+	for (uint8_t m = 0; m < count; m++)
+		bytes[m] = b;
+
+	writeBytes(bytes);
+}
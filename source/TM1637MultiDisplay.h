@@ -0,0 +1,152 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Vários displays TM1637 atualizados em paralelo em uma porta.
+ *
+ * @file        TM1637MultiDisplay.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637MULTIDISPLAY__
+#define __TM1637MULTIDISPLAY__
+
+#include <inttypes.h>
+#include "mkl_DevGPIOPort.h"
+#include "TM1637Display.h"
+
+// Número máximo de módulos em um mesmo barramento
+#define TM1637_MULTI_MAX 8
+
+/*!
+ *  @class    TM1637MultiDisplay
+ *
+ *  @brief    Conjunto de módulos TM1637 com um clock comum e um DIO por módulo.
+ *
+ *  @details  Todos os pinos ficam na mesma porta. Cada meio período de bit é uma
+ *            única escrita do PDDR da porta, levando um bit diferente a cada
+ *            módulo, de modo que N displays são atualizados no tempo de um. Os
+ *            ACKs de todos os módulos vêm de uma única leitura do PDIR.
+ *
+ *            Os dígitos são preparados com setSegments() e enviados juntos por
+ *            update(). Como os módulos recebem a mesma sequência de comandos,
+ *            cada atualização cobre, em todos eles, as posições entre o primeiro
+ *            e o último dígito alterado em qualquer módulo.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              const gpio_Pin dios[] = { gpio_PTC1, gpio_PTC2, gpio_PTC3 };
+ *              TM1637MultiDisplay displays(gpio_PTC0, dios, 3);
+ *              displays.setSegments(0, segments, first, four);
+ *              displays.setSegments(2, segments, first, four);
+ *              displays.update();
+ */
+class TM1637MultiDisplay {
+
+public:
+/*!
+ * Configura o clock comum e os pinos de dados
+ *
+ * Pinos de dados fora da porta do clock, ou além de TM1637_MULTI_MAX, são
+ * ignorados; getCount() retorna o número de módulos aceitos, na ordem dada.
+ *
+ * Com gpio_fast o PDDR da porta é lido e reescrito a cada meio período de bit;
+ * só deve ser usado se nenhuma interrupção mudar a direção de outros pinos da
+ * porta (veja gpio_AccessPath).
+ */
+	TM1637MultiDisplay(gpio_Pin pinClk, const gpio_Pin pinsDIO[], uint8_t count,
+			gpio_AccessPath accessPath = GPIO_DEFAULT_ACCESS_PATH);
+
+	uint8_t getCount() const;
+
+/*!
+ * Define o brilho de todos os módulos, aplicado no próximo update()
+ */
+	void setBrightness(uint8_t _brightness, bool on = true);
+
+/*!
+ * Prepara os segmentos de um módulo, sem enviar
+ *
+ * @param module O índice do módulo, na ordem dos pinos do construtor
+ */
+	void setSegments(uint8_t module, const uint8_t segments[], digitPosition pos,
+			numLength length);
+
+/*!
+ * Apaga todas as posições (TM1637_MAX_DIGITS) de todos os módulos, aplicado
+ * no próximo update()
+ */
+	void clear();
+
+/*!
+ * Envia a todos os módulos, em paralelo, os dígitos alterados e o brilho
+ */
+	void update();
+
+/*!
+ * Módulos (bit n = módulo n) que não responderam com ACK no último update()
+ */
+	uint8_t getNackMask() const;
+
+/*!
+ * Define a frequência alvo do clock, como em TM1637Display
+ */
+	void setBusFrequency(busFrequency frequency);
+
+	void calibrateTiming();
+
+protected:
+	void start();
+	void stop();
+
+/*!
+ * Envia um byte por módulo em paralelo e acumula os NACKs
+ */
+	void writeBytes(const uint8_t bytes[]);
+
+/*!
+ * Envia o mesmo byte a todos os módulos
+ */
+	void writeCommon(uint8_t b);
+
+private:
+	mkl_DevGPIOPort port;
+	uint32_t clkMask;
+	uint32_t dioAll;
+	uint32_t dioMask[TM1637_MULTI_MAX];
+	uint8_t count = 0;
+
+/*!
+ * Estado atual das direções do clock e dos DIOs (bit em 1 = linha em nível baixo)
+ */
+	uint32_t lines = 0;
+
+	tm1637_Timing timing = { freq250kHz, 0, 0, 0 };
+
+/*!
+ * Dígitos preparados, posições alteradas desde o último envio e cache de comandos
+ */
+	uint8_t shadow[TM1637_MULTI_MAX][TM1637_MAX_DIGITS];
+	uint8_t dirty = 0;
+	uint8_t brightness = 0x0f;
+	uint8_t lastControl = 0;
+	bool dataCommandSent = false;
+	uint8_t nackMask = 0;
+};
+
+#endif // __TM1637MULTIDISPLAY__
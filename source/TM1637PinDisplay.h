@@ -0,0 +1,104 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Display TM1637 com os pinos definidos em tempo de compilação.
+ *
+ * @file        TM1637PinDisplay.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637PINDISPLAY__
+#define __TM1637PINDISPLAY__
+
+#include "mkl_DevGPIO.h"
+#include "TM1637Display.h"
+
+/*!
+ *  @class    TM1637PinDisplay
+ *
+ *  @brief    Display TM1637 com pinos de clock e dados como parâmetros de template.
+ *
+ *  @details  Os pinos são mkl_DevGPIOPin, sem estado e com endereços constantes,
+ *            de modo que o laço de bit-bang acessa os registradores diretamente
+ *            e o objeto não guarda nenhuma cópia dos pinos (ao contrário de
+ *            TM1637Display, que guarda dois mkl_DevGPIO). A interface é a mesma
+ *            de TM1637Display, herdada de TM1637Core.
+ *
+ *            O caminho padrão é o da ponte, com escritas atômicas do BME.
+ *            gpio_fast deve ser pedido explicitamente: o PDDR passa a ser lido
+ *            e reescrito, e uma interrupção que mude a direção de outro pino
+ *            da porta nesse intervalo tem a mudança desfeita.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              TM1637PinDisplay<gpio_PTA1, gpio_PTA2> display;
+ *              display.write(42, first);
+ *
+ *              // Sem outros usuários da porta A em interrupções
+ *              TM1637PinDisplay<gpio_PTA1, gpio_PTA2, gpio_fast> fastDisplay;
+ */
+template<gpio_Pin CLK, gpio_Pin DIO, gpio_AccessPath A = GPIO_DEFAULT_ACCESS_PATH>
+class TM1637PinDisplay : public TM1637Core {
+
+public:
+	typedef mkl_DevGPIOPin<CLK, A> pinClk;
+	typedef mkl_DevGPIOPin<DIO, A> pinDIO;
+
+	TM1637PinDisplay()
+	{
+		pinClk::init();
+		pinDIO::init();
+
+		pinClk::setPortMode(gpio_input);
+		pinDIO::setPortMode(gpio_input);
+		pinClk::writeBit(0);
+		pinDIO::writeBit(0);
+	}
+
+	void calibrateTiming()
+	{
+		pinDIO dio;
+		tm1637_calibrate(dio, timing);
+	}
+
+protected:
+	void sendBlocking(const tm1637_Transfer &transfer)
+	{
+		pinClk clk;
+		pinDIO dio;
+
+		if (timing.calibratedClock != SystemCoreClock)
+			calibrateTiming();
+
+		tm1637_send(clk, dio, timing, transfer);
+	}
+
+	uint8_t readBlocking(uint8_t command)
+	{
+		pinClk clk;
+		pinDIO dio;
+
+		if (timing.calibratedClock != SystemCoreClock)
+			calibrateTiming();
+
+		return tm1637_read(clk, dio, timing, command);
+	}
+};
+
+#endif // __TM1637PINDISPLAY__
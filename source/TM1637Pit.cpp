@@ -0,0 +1,53 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Distribuição da interrupção do PIT entre os canais.
+ *
+ * @file        TM1637Pit.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "TM1637Pit.h"
+
+/*!
+ * Tratadores associados a cada canal do PIT
+ */
+static TM1637PitHandler *pitInstances[FSL_FEATURE_PIT_TIMER_COUNT];
+
+void tm1637_attachPit(pit_chnl_t channel, TM1637PitHandler *handler)
+{
+	pitInstances[channel] = handler;
+
+	if (handler == nullptr) {
+		PIT_DisableInterrupts(PIT, channel, kPIT_TimerInterruptEnable);
+		return;
+	}
+
+	PIT_EnableInterrupts(PIT, channel, kPIT_TimerInterruptEnable);
+	NVIC_EnableIRQ(PIT_IRQn);
+}
+
+extern "C" void PIT_IRQHandler(void)
+{
+	for (uint8_t channel = 0; channel < FSL_FEATURE_PIT_TIMER_COUNT; channel++) {
+		if (pitInstances[channel] != nullptr
+				&& PIT_GetStatusFlags(PIT, (pit_chnl_t)channel) & kPIT_TimerFlag)
+			pitInstances[channel]->handleInterrupt();
+	}
+}
@@ -0,0 +1,54 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Distribuição da interrupção do PIT entre os canais.
+ *
+ * @file        TM1637Pit.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +peripheral   Display TM1637.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef __TM1637PIT__
+#define __TM1637PIT__
+
+#include <inttypes.h>
+#include "fsl_pit.h"
+
+/*!
+ *  @class    TM1637PitHandler
+ *
+ *  @brief    Tratador de um canal do PIT.
+ *
+ *  @details  Os canais do PIT compartilham uma única interrupção; PIT_IRQHandler
+ *            chama handleInterrupt() do tratador associado a cada canal com a
+ *            flag ativa. O tratador deve limpar a flag do seu canal.
+ */
+class TM1637PitHandler {
+
+public:
+	virtual void handleInterrupt() = 0;
+};
+
+/*!
+ * Associa um tratador a um canal do PIT e habilita a interrupção do canal
+ *
+ * @param handler O tratador, ou nullptr para desassociar o canal
+ */
+void tm1637_attachPit(pit_chnl_t channel, TM1637PitHandler *handler);
+
+#endif // __TM1637PIT__
@@ -48,6 +48,22 @@
 #include "mkl_DevGPIO.h"
 #include "TM1637Display.h"
 
+#ifdef TM1637_BENCHMARK
+#include "TM1637Benchmark.h"
+
+/*!
+ *	Resultados das medições, para inspeção pelo depurador
+ */
+tm1637_FrameRate frameRate100kHz;
+tm1637_FrameRate frameRate250kHz;
+tm1637_FrameRate frameRate500kHz;
+tm1637_RefreshComparison refreshCost;
+tm1637_AsyncLoad asyncLoad;
+tm1637_AccessComparison accessCost;
+tm1637_FormatComparison formatCost;
+tm1637_FixedCost fixedCost;
+#endif
+
 /*!
  * 	Declaração dos pinos de clock e dados do periférico
  */
@@ -61,6 +77,10 @@ mkl_DevGPIO clk(gpio_PTA1);
 
 TM1637Display display(clk,dio);
 
+#ifdef TM1637_BENCHMARK
+TM1637AsyncBus asyncBus(clk, dio);
+#endif
+
 void delayms(unsigned int time) {
 	unsigned int i;
 	int j;
@@ -75,6 +95,20 @@ void setup(){
 	display.setDigitMode(hide);
 	display.setLength(one);
 	display.setDoubleDots(false);
+
+#ifdef TM1637_BENCHMARK
+	frameRate100kHz = TM1637Benchmark::frameRate(display, freq100kHz, 16);
+	frameRate250kHz = TM1637Benchmark::frameRate(display, freq250kHz, 16);
+	frameRate500kHz = TM1637Benchmark::frameRate(display, freq500kHz, 16);
+	display.setBusFrequency(freq250kHz);
+	refreshCost = TM1637Benchmark::refreshCost(display, 16);
+	accessCost = TM1637Benchmark::accessCost(display, gpio_PTA1, gpio_PTA2, 16);
+	formatCost = TM1637Benchmark::formatCost(display, 64);
+	fixedCost = TM1637Benchmark::fixedCost(display, 64);
+
+	asyncBus.begin(freq100kHz);
+	asyncLoad = TM1637Benchmark::asyncLoad(display, asyncBus, 1000000);
+#endif
 }
 
 uint8_t data[] = { };
@@ -92,10 +126,8 @@ int main(void) {
     while (1) {
     	int floor = 0;
     	while(floor < 16) {
-    		display.writeHexadecimal(floor, first);
-    		display.writeHexadecimal(floor, second);
-    		display.writeHexadecimal(floor, third);
-    		display.writeHexadecimal(floor, fourth);
+    		uint8_t digits[] = { (uint8_t)floor, (uint8_t)floor, (uint8_t)floor, (uint8_t)floor };
+    		display.writeDigits(digits);
     		floor++;
 
     	}
@@ -0,0 +1,60 @@
+/*!
+ * @copyright   � 2020 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementação do contador de ciclos baseado no SysTick.
+ *
+ * @file        mkl_CycleCounter.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_CycleCounter.h"
+#include "system_MKL25Z4.h"
+
+mkl_CycleCounter::mkl_CycleCounter()
+{
+	// Coloca o SysTick em modo livre caso a aplicação não o utilize
+	if (!(SysTick->CTRL & SysTick_CTRL_ENABLE_Msk)) {
+		SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+		SysTick->VAL = 0;
+		SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+	}
+
+	period = SysTick->LOAD + 1;
+	startValue = SysTick->VAL;
+}
+
+void mkl_CycleCounter::start()
+{
+	startValue = SysTick->VAL;
+}
+
+uint32_t mkl_CycleCounter::elapsed() const
+{
+	uint32_t now = SysTick->VAL;
+
+	// O SysTick é decrescente e recarrega em LOAD ao passar por zero
+	if (now <= startValue)
+		return startValue - now;
+
+	return startValue + period - now;
+}
+
+uint32_t mkl_CycleCounter::toMicroseconds(uint32_t cycles)
+{
+	return cycles / (SystemCoreClock / 1000000);
+}
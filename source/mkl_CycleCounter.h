@@ -0,0 +1,71 @@
+/*!
+ * @copyright   � 2020 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do contador de ciclos baseado no SysTick.
+ *
+ * @file        mkl_CycleCounter.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "MKL25Z4.h"
+
+/*!
+ *  @class    mkl_CycleCounter
+ *
+ *  @brief    Mede intervalos em ciclos do núcleo usando o SysTick.
+ *
+ *  @details  O Cortex-M0+ não possui o contador DWT_CYCCNT, portanto o SysTick
+ *            (decrescente, 24 bits, clock do núcleo) é usado como base de tempo.
+ *            Se o SysTick ainda não estiver habilitado, ele é configurado em
+ *            modo livre, sem interrupção. Se a aplicação já o utiliza, o valor
+ *            de recarga atual é respeitado. Intervalos devem ser menores que
+ *            um período do SysTick (2^24 ciclos, ~349 ms a 48 MHz).
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              mkl_CycleCounter counter;
+ *              counter.start();
+ *              display.write(42, first);
+ *              uint32_t cycles = counter.elapsed();
+ */
+class mkl_CycleCounter {
+public:
+	mkl_CycleCounter();
+
+/*!
+ * Marca o instante inicial da medição
+ */
+	void start();
+
+/*!
+ * Retorna o número de ciclos do núcleo decorridos desde start()
+ */
+	uint32_t elapsed() const;
+
+/*!
+ * Converte ciclos do núcleo em microssegundos usando SystemCoreClock
+ */
+	static uint32_t toMicroseconds(uint32_t cycles);
+
+private:
+	uint32_t startValue;
+	uint32_t period;
+};
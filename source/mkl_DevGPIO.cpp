@@ -57,18 +57,105 @@
  */
 
 #include <mkl_DevGPIO.h>
+#include "mkl_DevGPIOEvents.h"
+
+/*!
+ * Tabela de despacho das interrupções de uma porta, indexada pelo número do
+ * pino. Pinos em eventPins gravam um evento na fila do pino em vez de chamar
+ * exec(); risingPins e fallingPins são os que disparam em uma única borda.
+ */
+struct gpio_PortDispatch {
+  mkl_DevGPIO *pins[32];
+  mkl_DevGPIOEvents *events[32];
+  uint32_t registered;
+  uint32_t eventPins;
+  uint32_t risingPins;
+  uint32_t fallingPins;
+};
+
+/*!
+ * Só PORTA e PORTD têm IRQ no KL25.
+ */
+static gpio_PortDispatch portDispatch[2];
+
+/*!
+ * Índice do bit menos significativo em 1, por multiplicação de De Bruijn (o
+ * Cortex-M0+ não tem CLZ nem RBIT).
+ */
+static const uint8_t deBruijnPosition[32] = {
+  0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+  31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+};
+
+static inline uint32_t lowestBitIndex(uint32_t bits) {
+  return deBruijnPosition[((bits & -bits) * 0x077CB531UL) >> 27];
+}
+
+/*!
+ *   @brief      Despacha as interrupções pendentes de uma porta.
+ *
+ *   O ISFR é lido uma única vez e as flags dos pinos registrados são limpas
+ *   com uma única escrita (write-1-to-clear) antes das chamadas, de modo que
+ *   uma nova borda durante um tratador volta a ficar pendente. O laço percorre
+ *   só os bits em 1, então o custo depende dos pinos disparados, e não dos
+ *   registrados.
+ */
+static void dispatchPortInterrupt(volatile uint32_t *isfr,
+                                  volatile uint32_t *pdir, uint16_t gpioName,
+                                  const gpio_PortDispatch &port) {
+  // Só os pinos registrados: flags de pinos em modo de DMA são limpas pelo
+  // próprio DMA, e as dos demais ficam para getInterruptFlag()
+  uint32_t pending = *isfr & port.registered;
+  uint32_t events = pending & port.eventPins;
+
+  *isfr = pending;
+
+  // Pinos em modo de eventos: uma leitura do TPM1 e do PDIR para todos eles
+  if (events != 0) {
+    uint16_t time = mkl_DevGPIOEvents::timestamp();
+    uint32_t rising = (*pdir & ~port.fallingPins) | port.risingPins;
+
+    pending &= ~events;
+    while (events != 0) {
+      uint32_t pin = lowestBitIndex(events);
+
+      port.events[pin]->push(gpioName | pin, (gpio_Edge)((rising >> pin) & 1),
+                             time);
+      events &= events - 1;
+    }
+  }
+
+  while (pending != 0) {
+    mkl_DevGPIO *gpio = port.pins[lowestBitIndex(pending)];
+
+    if (gpio != nullptr) {
+      gpio->exec();
+    }
+    pending &= pending - 1;
+  }
+}
+
+extern "C" void PORTA_IRQHandler(void) {
+  dispatchPortInterrupt(&PORTA->ISFR, &FGPIOA->PDIR, gpio_GPIOA,
+                        portDispatch[0]);
+}
+
+extern "C" void PORTD_IRQHandler(void) {
+  dispatchPortInterrupt(&PORTD->ISFR, &FGPIOD->PDIR, gpio_GPIOD,
+                        portDispatch[1]);
+}
 
 mkl_DevGPIO::mkl_DevGPIO(){
 	// Vazio
 }
 
-mkl_DevGPIO::mkl_DevGPIO(gpio_Pin pin){
+mkl_DevGPIO::mkl_DevGPIO(gpio_Pin pin, gpio_AccessPath accessPath){
 
   uint32_t pinNumber;
   uint32_t gpio;
 
   setGPIOParameters(pin, gpio, pinNumber);
-  bindPeripheral(gpio, pinNumber);
+  bindPeripheral(gpio, pinNumber, accessPath);
   enableModuleClock(gpio);
   selectMuxAlternative();
   setPullResistor(gpio_pullUpResistor);
@@ -77,12 +164,16 @@ mkl_DevGPIO::mkl_DevGPIO(gpio_Pin pin){
   // bit number to the port
   // 0x000 -> gpio_GPIOA or
   // 0x300 -> gpio_GPIOD
+  addressPortxISFR = nullptr;
+  interruptPort = 0xFF;
   if ( gpio == 0x000 ) {
     addressPortxISFR =  (volatile uint32_t *)0x400490A0;
     PORTx_IRQn = PORTA_IRQn;
-  } else if ( (pin & 0xFF0) == 0x300 ) {
+    interruptPort = 0;
+  } else if ( gpio == 0x003 ) {
     addressPortxISFR =  (volatile uint32_t *)0x4004C0A0;
     PORTx_IRQn = PORTD_IRQn;
+    interruptPort = 1;
   }
 
   bitPosition = pinNumber;
@@ -90,10 +181,22 @@ mkl_DevGPIO::mkl_DevGPIO(gpio_Pin pin){
 }
 
 void mkl_DevGPIO::setPortMode(gpio_PortMode mode) {
+  // gpio_fast: leitura e escrita do PDDR pelo FGPIO, não indivisível
+  if (addressPDDRSet == nullptr) {
+    if (mode == gpio_input) {
+      *addressPDDR &= ~pinPort;
+    } else {
+      *addressPDDR |= pinPort;
+    }
+    return;
+  }
+
+  // Escritas decoradas do BME: uma única escrita, sem ler o PDDR antes, de
+  // modo que interrupções que mudem outros pinos da porta não são perdidas
   if (mode == gpio_input) {
-    *addressPDDR &= ~pinPort;
+    *addressPDDRClear = ~pinPort;
   } else {
-    *addressPDDR |= pinPort;
+    *addressPDDRSet = pinPort;
   }
 }
 
@@ -114,8 +217,8 @@ void mkl_DevGPIO::setPortMode(gpio_PortMode mode) {
  *               - PortxPCRn: Pin Control Register. P�g. 183 (Mux) and 185 (Pull).
  */
 void mkl_DevGPIO::setPullResistor(gpio_PullResistor pull) {
-  *addressPortxPCRn &= ~(PORT_PCR_PS_MASK | PORT_PCR_PE_MASK);
-  *addressPortxPCRn |= pull;
+  // Insere os campos PE e PS (bits 1 e 0) com um BFI do BME
+  *(volatile uint32_t *)BME_BFI(addressPortxPCRn, PORT_PCR_PS_SHIFT, 2) = pull;
 }
 
 /*!
@@ -129,13 +232,14 @@ void mkl_DevGPIO::setPullResistor(gpio_PullResistor pull) {
  *   @param[in]  bit - O valor do bit a ser escrito no pino da porta de sa�da.
  *
  *   @remarks    Siglas e p�ginas do Manual de Refer�ncia KL25:
- *               - PDOR: Port Data Output Register. P�g. 775.
+ *               - PSOR: Port Set Output Register. P�g. 776.
+ *               - PCOR: Port Clear Output Register. P�g. 776.
  */
 void mkl_DevGPIO::writeBit(int bit) {
   if (bit) {
-    *addressPDOR |= pinPort;
+    *addressPSOR = pinPort;
   } else {
-    *addressPDOR &= ~pinPort;
+    *addressPCOR = pinPort;
   }
 }
 
@@ -174,7 +278,8 @@ int mkl_DevGPIO::readBit() {
  *             - PTOR: Port Toogle Output Register.P�g.777.
  */
 void mkl_DevGPIO::toogleBit() {
-  *addressPTOR |= pinPort;
+  // PTOR é somente escrita: os bits em 0 não alteram a saída
+  *addressPTOR = pinPort;
 }
 
 /*!
@@ -194,7 +299,8 @@ void mkl_DevGPIO::getInterruptFlag() {
  *                - PortxPCRn: Pin Control Register.Pág. 183(Mux) and 185(Pull).
  */
 void mkl_DevGPIO::clearInterruptFlag() {
-  *addressPortxISFR |= ~ISFR;
+  // O ISFR é write-1-to-clear: escreve só o bit deste pino, se estava pendente
+  *addressPortxISFR = ISFR & pinPort;
 }
 
 /*!
@@ -216,11 +322,59 @@ bool mkl_DevGPIO::thisGpioTriggedIntr() {
  */
 void mkl_DevGPIO::enableInterrupt
   (gpio_InterruptTrigger interruptTrigger) {
-  // Inicializa o campo IRQC e mantem o restante inalterado
-  *addressPortxPCRn &= ~0xF0000;
+  armInterrupt(interruptTrigger, nullptr);
+}
 
-  // Configura o tipo de interrupcao
-  *addressPortxPCRn |= interruptTrigger;
+/*!
+ *   @brief      Habilita as interrupções do pino em modo de eventos.
+ *
+ *   A interrupção só grava (pino, borda, marca de tempo) em @ref events, sem
+ *   chamar exec(). O TPM1 é iniciado com o divisor padrão se ainda não estiver
+ *   contando.
+ */
+void mkl_DevGPIO::enableEvents(gpio_InterruptTrigger interruptTrigger,
+                               mkl_DevGPIOEvents &events) {
+  if (!mkl_DevGPIOEvents::isRunning()) {
+    mkl_DevGPIOEvents::begin();
+  }
+
+  armInterrupt(interruptTrigger, &events);
+}
+
+void mkl_DevGPIO::armInterrupt(gpio_InterruptTrigger interruptTrigger,
+                               mkl_DevGPIOEvents *events) {
+  // Só PORTA e PORTD geram interrupções no KL25
+  if (interruptPort > 1) {
+    return;
+  }
+
+  // Pedidos de DMA não passam pelo núcleo: o pino sai da tabela de despacho e
+  // a flag pendente é limpa para não disparar uma transferência imediata
+  if (interruptTrigger < gpio_whenLogicZero) {
+    unregisterInterrupt();
+    *addressPortxISFR = pinPort;
+    *(volatile uint32_t *)BME_BFI(addressPortxPCRn, PORT_PCR_IRQC_SHIFT, 4) =
+        interruptTrigger;
+    return;
+  }
+
+  gpio_PortDispatch &port = portDispatch[interruptPort];
+
+  // Registra o pino na tabela de despacho da porta antes de armar o IRQC
+  port.pins[bitPosition] = this;
+  port.events[bitPosition] = events;
+  port.eventPins = (events != nullptr) ? port.eventPins | pinPort
+                                       : port.eventPins & ~pinPort;
+  port.risingPins = (interruptTrigger == gpio_onRisingEdge)
+                      ? port.risingPins | pinPort : port.risingPins & ~pinPort;
+  port.fallingPins = (interruptTrigger == gpio_onFallingEdge)
+                       ? port.fallingPins | pinPort : port.fallingPins & ~pinPort;
+  port.registered |= pinPort;
+
+  // Insere o tipo de interrupcao no campo IRQC com um BFI do BME,
+  // mantendo o restante inalterado
+  *(volatile uint32_t *)BME_BFI(addressPortxPCRn, PORT_PCR_IRQC_SHIFT, 4) =
+      interruptTrigger;
 
   // Habilita a interrupcaoo para a porta correspondente
   NVIC_EnableIRQ(PORTx_IRQn);
@@ -234,11 +388,32 @@ void mkl_DevGPIO::enableInterrupt
  *               - PortxPCRn: Pin Control Register.Pág. 183 (Mux) and 185 (Pull).
  */
 void mkl_DevGPIO::disableInterrupt() {
+  if (interruptPort > 1) {
+    return;
+  }
+
   // Zera o campo IRQC;
-  *addressPortxPCRn |= 0x00000;
+  *(volatile uint32_t *)BME_BFI(addressPortxPCRn, PORT_PCR_IRQC_SHIFT, 4) = 0;
 
-  // Desabiliza a interrupcao
-  NVIC_DisableIRQ(PORTx_IRQn);
+  unregisterInterrupt();
+}
+
+/*!
+ *   @brief      Remove o pino da tabela de despacho da porta.
+ *
+ *   A interrupcao da porta so e desabilitada quando nenhum outro pino dela
+ *   continua registrado.
+ */
+void mkl_DevGPIO::unregisterInterrupt() {
+  gpio_PortDispatch &port = portDispatch[interruptPort];
+
+  port.pins[bitPosition] = nullptr;
+  port.events[bitPosition] = nullptr;
+  port.eventPins &= ~pinPort;
+  port.registered &= ~pinPort;
+  if (port.registered == 0) {
+    NVIC_DisableIRQ(PORTx_IRQn);
+  }
 }
 
 
@@ -255,9 +430,18 @@ void mkl_DevGPIO::disableInterrupt() {
  *             - PDDR: Port Direct Input Register. P�g. 778.
  *             - PTOR: Port Toogle Output Register.P�g.777.
  *             - PortxPCRn: Pin Control Register.P�g. 183 (Mux) and 185 (Pull).
+ *             - FGPIO: Fast GPIO, alias dos registradores na IOPORT.
  */
-void mkl_DevGPIO::bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber) {
+void mkl_DevGPIO::bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber,
+                                 gpio_AccessPath accessPath) {
   uint32_t baseAddress;
+  uint32_t gpioBase;
+
+  /*!
+   * Os mesmos registradores são vistos pela IOPORT em FGPIOA_BASE (0xF80FF000),
+   * com acesso de ciclo único pelo núcleo. O PCR continua na ponte.
+   */
+  gpioBase = (accessPath == gpio_fast) ? FGPIOA_BASE : GPIOA_BASE;
 
   /*!
    * C�lculo do endere�o base do GPIO do par�metro "GPIOBaseAddress".
@@ -265,7 +449,7 @@ void mkl_DevGPIO::bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber) {
    * GPIOBaseAddress = 0x400FF000 (Base GPIOA) + 0x40*(0,1,2,3 ou 4) (Offset).
    *
    */
-  baseAddress = GPIOA_BASE + (uint32_t)(0x40*GPIONumber);
+  baseAddress = gpioBase + (uint32_t)(0x40*GPIONumber);
 
   /*!
    * C�lculo do endere�o absoluto do PDOR para o GPIO.
@@ -295,6 +479,30 @@ void mkl_DevGPIO::bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber) {
    */
   addressPTOR = (volatile uint32_t *)(baseAddress + 0xC);
 
+  /*!
+   * Endereços absolutos do PSOR e do PCOR para o GPIO.
+   * addressPSOR = address base (Base) + 0x4 (Offset).
+   * addressPCOR = address base (Base) + 0x8 (Offset).
+   */
+  addressPSOR = (volatile uint32_t *)(baseAddress + 0x4);
+  addressPCOR = (volatile uint32_t *)(baseAddress + 0x8);
+
+  /*!
+   * Endereços decorados do BME para o PDDR, pelo alias do GPIO em 0x4000F000.
+   * No modo gpio_fast ficam nulos: o PDDR é lido e reescrito pelo FGPIO, em
+   * acessos de um ciclo, pois uma escrita do BME passa pela ponte e anularia
+   * o ganho do FGPIO no laço de bit-bang.
+   */
+  if (accessPath == gpio_fast) {
+    addressPDDRSet = nullptr;
+    addressPDDRClear = nullptr;
+  } else {
+    addressPDDRSet = (volatile uint32_t *)BME_OR(GPIO_BME_ALIAS_BASE
+                       + 0x40*GPIONumber + 0x14);
+    addressPDDRClear = (volatile uint32_t *)BME_AND(GPIO_BME_ALIAS_BASE
+                         + 0x40*GPIONumber + 0x14);
+  }
+
   /*!
    * C�lculo do endere�o absoluto do PCR para o GPIO.
    * Address(hexa): GPIOA=400FF014 B=400FF054 C=400FF094 D=400FF0D4 E=400FF114.
@@ -352,7 +560,7 @@ void mkl_DevGPIO::setGPIOParameters(gpio_Pin pin, uint32_t &gpio,
                                      uint32_t &pinNumber) {
   pinNumber = pin & 0xFF;
   gpio = pin >> 8;
-  pinPort = 1 << pin;
+  pinPort = 1 << pinNumber;
 }
 
 void mkl_DevGPIO::runInterruptFunction(){
@@ -49,6 +49,8 @@
 #include "MKL25Z.h"
 #include "Callback.h"
 
+class mkl_DevGPIOEvents;
+
 /*!
  * Namespace de defini��o dos GPIOs e pinos implementados.
  */
@@ -104,8 +106,57 @@ typedef enum {
 	gpio_input = 0, gpio_output = 1
 } gpio_PortMode;
 
+/*!
+ * Namespace de definição do caminho de acesso aos registradores do GPIO.
+ *
+ * gpio_bridge usa os registradores GPIOx na ponte de periféricos (0x400FF000),
+ * com vários ciclos de barramento por acesso. gpio_fast usa o alias FGPIOx na
+ * IOPORT do Cortex-M0+ (0xF80FF000), acessado em um único ciclo pelo núcleo,
+ * mas invisível ao DMA.
+ *
+ * Com gpio_bridge, setPortMode() é uma única escrita do BME no PDDR, segura
+ * contra interrupções que mudem outros pinos da porta. Com gpio_fast, o PDDR é
+ * lido e reescrito pelo FGPIO: mais rápido, mas uma interrupção entre a
+ * leitura e a escrita que mude a direção de outro pino da porta é desfeita.
+ */
+typedef enum {
+	gpio_bridge = 0, gpio_fast = 1
+} gpio_AccessPath;
+
+/*!
+ * Endereços decorados do Bit Manipulation Engine (BME).
+ *
+ * Uma escrita no endereço decorado faz a leitura, a operação e a escrita do
+ * registrador em um único acesso indivisível ao barramento. O BME atende os
+ * periféricos em 0x40000000-0x4007FFFF; o GPIO é alcançado pelo seu alias em
+ * GPIO_BME_ALIAS_BASE.
+ *
+ * Em BME_BFI o dado escrito já deve estar na posição do campo.
+ */
+#define BME_AND(address)  ((uint32_t)(uintptr_t)(address) | 0x04000000)
+#define BME_OR(address)   ((uint32_t)(uintptr_t)(address) | 0x08000000)
+#define BME_XOR(address)  ((uint32_t)(uintptr_t)(address) | 0x0C000000)
+#define BME_BFI(address, bit, width) (((uint32_t)(uintptr_t)(address) & 0xE007FFFF) \
+                                      | 0x10000000 | ((bit) << 23) | (((width) - 1) << 19))
 
+#define GPIO_BME_ALIAS_BASE 0x4000F000
+
+/*!
+ * Caminho de acesso usado quando o construtor não recebe um explicitamente.
+ */
+#ifndef GPIO_DEFAULT_ACCESS_PATH
+#define GPIO_DEFAULT_ACCESS_PATH gpio_bridge
+#endif
+
+
+/*!
+ * Modos do campo IRQC do PORTx_PCRn. Os modos gpio_dma* geram um pedido de DMA
+ * (DMAMUX, fontes PTA e PTD) em vez de uma interrupção; veja mkl_DevGPIOCapture.
+ */
 typedef enum {
+  gpio_dmaOnRisingEdge = 0b0001 << 16,
+  gpio_dmaOnFallingEdge = 0b0010 << 16,
+  gpio_dmaOnEitherEdge = 0b0011 << 16,
   gpio_whenLogicZero = 0b1000 << 16,
   gpio_onRisingEdge = 0b1001 << 16,
   gpio_onFallingEdge = 0b1010 << 16,
@@ -139,7 +190,8 @@ public:
 	 * Construtor padrão classe.
 	 */
 	mkl_DevGPIO();
-	explicit mkl_DevGPIO(gpio_Pin pin);
+	explicit mkl_DevGPIO(gpio_Pin pin,
+			gpio_AccessPath accessPath = GPIO_DEFAULT_ACCESS_PATH);
 	/*!
 	 * M�todos de configura��o do pino.
 	 */
@@ -158,7 +210,19 @@ public:
 	/*!
 	 * Métodos que tratam da interrupção.
 	 */
+	/*!
+	 * enableInterrupt() registra o pino na tabela de despacho da sua porta
+	 * (PORTA ou PORTD); PORTA_IRQHandler e PORTD_IRQHandler chamam exec() dos
+	 * pinos disparados e limpam as flags. O objeto deve continuar existindo
+	 * até disableInterrupt().
+	 */
 	void enableInterrupt(gpio_InterruptTrigger interruptTrigger);
+	/*!
+	 * Como enableInterrupt(), mas a interrupção só grava um evento de borda
+	 * em @ref events, para ser tratado no laço principal (mkl_DevGPIOEvents.h).
+	 */
+	void enableEvents(gpio_InterruptTrigger interruptTrigger,
+			mkl_DevGPIOEvents &events);
 	void disableInterrupt();
 	void runInterruptFunction();
 
@@ -166,6 +230,9 @@ protected:
 	void getInterruptFlag();
 	bool thisGpioTriggedIntr();
 	void clearInterruptFlag();
+	void armInterrupt(gpio_InterruptTrigger interruptTrigger,
+			mkl_DevGPIOEvents *events);
+	void unregisterInterrupt();
 	/*!
 	 * Endere�o do registrador PDDR no mapa de mem�ria.
 	 */
@@ -182,6 +249,16 @@ protected:
 	 * Endere�o do registrador PTOR no mapa de mem�ria.
 	 */
 	volatile uint32_t *addressPTOR;
+	/*!
+	 * Endereços dos registradores PSOR e PCOR no mapa de memória.
+	 */
+	volatile uint32_t *addressPSOR;
+	volatile uint32_t *addressPCOR;
+	/*!
+	 * Endereços decorados do BME para setar e limpar bits do PDDR.
+	 */
+	volatile uint32_t *addressPDDRSet;
+	volatile uint32_t *addressPDDRClear;
 	/*!
 	 * Endere�o do registrador Port PCR no mapa de mem�ria.
 	 */
@@ -195,7 +272,8 @@ protected:
 	/*!
 	 * M�todos privados de inicializa��o do perif�rico.
 	 */
-	void bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber);
+	void bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber,
+			gpio_AccessPath accessPath);
 	void enableModuleClock(uint8_t GPIONumber);
 	void selectMuxAlternative();
 	void setGPIOParameters(gpio_Pin pin, uint32_t &gpio, uint32_t &pinNumber);
@@ -205,4 +283,103 @@ private:
  uint32_t ISFR;
  IRQn_Type PORTx_IRQn;
  uint8_t bitPosition;
+ uint8_t interruptPort;
+};
+
+/*!
+ *  @class    mkl_DevGPIOPin
+ *
+ *  @brief    Pino do GPIO especializado em tempo de compilação.
+ *
+ *  @details  Os endereços dos registradores e a máscara do pino são constantes
+ *            de compilação, de modo que cada operação vira um acesso direto ao
+ *            registrador, sem ponteiros armazenados. A classe não tem estado:
+ *            objetos ocupam só o mínimo exigido pela linguagem e podem ser
+ *            criados livremente. O pino é configurado como GPIO por init().
+ *
+ *            Só o modo de pino e as operações de leitura e escrita estão
+ *            disponíveis; interrupções continuam com mkl_DevGPIO.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              typedef mkl_DevGPIOPin<gpio_PTA1, gpio_fast> clk;
+ *              clk::init();
+ *              clk::setPortMode(gpio_output);
+ *              clk::writeBit(1);
+ */
+template<gpio_Pin P, gpio_AccessPath A = GPIO_DEFAULT_ACCESS_PATH>
+class mkl_DevGPIOPin {
+public:
+	/*!
+	 * Número do GPIO, número do pino e máscara do pino.
+	 */
+	static constexpr uint32_t gpioNumber = (uint32_t)P >> 8;
+	static constexpr uint32_t pinNumber = (uint32_t)P & 0xFF;
+	static constexpr uint32_t pinMask = 1UL << pinNumber;
+
+	/*!
+	 * Endereços dos registradores do GPIO pelo caminho de acesso escolhido.
+	 */
+	static constexpr uint32_t baseAddress =
+			(A == gpio_fast ? FGPIOA_BASE : GPIOA_BASE) + 0x40 * gpioNumber;
+	static constexpr uint32_t addressPDOR = baseAddress + 0x0;
+	static constexpr uint32_t addressPSOR = baseAddress + 0x4;
+	static constexpr uint32_t addressPCOR = baseAddress + 0x8;
+	static constexpr uint32_t addressPTOR = baseAddress + 0xC;
+	static constexpr uint32_t addressPDIR = baseAddress + 0x10;
+	static constexpr uint32_t addressPDDR = baseAddress + 0x14;
+	static constexpr uint32_t addressPortxPCRn = 0x40049000 + 0x1000 * gpioNumber
+			+ 4 * pinNumber;
+
+	/*!
+	 * Endereços decorados do BME para o PDDR, pelo alias do GPIO, usados só
+	 * com gpio_bridge (veja gpio_AccessPath).
+	 */
+	static constexpr uint32_t addressPDDRSet =
+			BME_OR(GPIO_BME_ALIAS_BASE + 0x40 * gpioNumber + 0x14);
+	static constexpr uint32_t addressPDDRClear =
+			BME_AND(GPIO_BME_ALIAS_BASE + 0x40 * gpioNumber + 0x14);
+
+	/*!
+	 * Habilita o clock da porta e seleciona o modo GPIO com pull up.
+	 */
+	static void init() {
+		SIM_SCGC5 |= SIM_SCGC5_PORTA_MASK << gpioNumber;
+		reg(addressPortxPCRn) = PORT_PCR_MUX(1) | gpio_pullUpResistor;
+	}
+
+	static void setPortMode(gpio_PortMode mode) {
+		if (A == gpio_fast) {
+			if (mode == gpio_input) {
+				reg(addressPDDR) &= ~pinMask;
+			} else {
+				reg(addressPDDR) |= pinMask;
+			}
+		} else if (mode == gpio_input) {
+			reg(addressPDDRClear) = ~pinMask;
+		} else {
+			reg(addressPDDRSet) = pinMask;
+		}
+	}
+
+	static void writeBit(int bit) {
+		if (bit) {
+			reg(addressPSOR) = pinMask;
+		} else {
+			reg(addressPCOR) = pinMask;
+		}
+	}
+
+	static void toogleBit() {
+		reg(addressPTOR) = pinMask;
+	}
+
+	static int readBit() {
+		return (reg(addressPDIR) & pinMask) ? 1 : 0;
+	}
+
+private:
+	static volatile uint32_t &reg(uint32_t address) {
+		return *(volatile uint32_t *)address;
+	}
 };
@@ -0,0 +1,150 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Barramento de pinos arbitrários de uma porta GPIO, lido e escrito como um valor.
+ *
+ * @file        mkl_DevGPIOBus.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_DevGPIOBus.h"
+
+uint32_t mkl_DevGPIOBus::collectMask(const gpio_Pin pins[], uint8_t count) {
+  uint32_t pinsMask = 0;
+  uint8_t accepted = 0;
+
+  for (uint8_t k = 0; k < count && accepted < GPIO_BUS_MAX_WIDTH; k++) {
+    if ((pins[k] >> 8) != (pins[0] >> 8)) {
+      continue;
+    }
+    pinsMask |= pinMask(pins[k]);
+    accepted++;
+  }
+
+  return pinsMask;
+}
+
+mkl_DevGPIOBus::mkl_DevGPIOBus(const gpio_Pin pins[], uint8_t count,
+                               gpio_AccessPath accessPath)
+    : mkl_DevGPIOPort((count != 0) ? (gpio_Name)(pins[0] & 0xFF00) : gpio_GPIOA,
+                      collectMask(pins, count), accessPath) {
+  // Sem pinos o barramento fica vazio, com largura 0, e pins não é lido
+  if (count == 0) {
+    return;
+  }
+
+  uint32_t GPIONumber = (uint32_t)pins[0] >> 8;
+
+  for (uint8_t k = 0; k < count && width < GPIO_BUS_MAX_WIDTH; k++) {
+    if (((uint32_t)pins[k] >> 8) != GPIONumber) {
+      continue;
+    }
+
+    int8_t shift = (int8_t)((pins[k] & 0xFF) - width);
+
+    // Os bits entram em ordem, então o último trecho sempre termina no bit
+    // anterior: basta o deslocamento ser o mesmo para estendê-lo
+    if (runCount == 0 || runs[runCount - 1].shift != shift) {
+      runs[runCount].busMask = 0;
+      runs[runCount].portMask = 0;
+      runs[runCount].shift = shift;
+      runCount++;
+    }
+    runs[runCount - 1].busMask |= 1UL << width;
+    runs[runCount - 1].portMask |= pinMask(pins[k]);
+    width++;
+  }
+
+  // Um só trecho de até 16 pinos é um campo de bits para o BFI do BME, que só
+  // alcança o GPIO pela ponte; com gpio_fast ficam o PSOR/PCOR e o PDDR do FGPIO
+  if (runCount == 1 && accessPath != gpio_fast) {
+    uint32_t lsb = runs[0].shift;
+    uint32_t gpioAlias = GPIO_BME_ALIAS_BASE + 0x40*GPIONumber;
+
+    fieldPDOR = (volatile uint32_t *)BME_BFI(gpioAlias + 0x0, lsb, width);
+    fieldPDDR = (volatile uint32_t *)BME_BFI(gpioAlias + 0x14, lsb, width);
+  }
+}
+
+uint8_t mkl_DevGPIOBus::getWidth() const {
+  return width;
+}
+
+uint32_t mkl_DevGPIOBus::scatter(uint32_t value) const {
+  uint32_t levels = 0;
+
+  for (uint8_t r = 0; r < runCount; r++) {
+    uint32_t bits = value & runs[r].busMask;
+    levels |= (runs[r].shift >= 0) ? bits << runs[r].shift
+                                   : bits >> -runs[r].shift;
+  }
+
+  return levels;
+}
+
+uint32_t mkl_DevGPIOBus::gather(uint32_t levels) const {
+  uint32_t value = 0;
+
+  for (uint8_t r = 0; r < runCount; r++) {
+    uint32_t bits = levels & runs[r].portMask;
+    value |= (runs[r].shift >= 0) ? bits >> runs[r].shift
+                                  : bits << -runs[r].shift;
+  }
+
+  return value;
+}
+
+void mkl_DevGPIOBus::write(uint32_t value) {
+  // O BFI recebe o dado já na posição do campo
+  if (fieldPDOR != nullptr) {
+    *fieldPDOR = scatter(value);
+    return;
+  }
+
+  uint32_t levels = scatter(value);
+  *addressPSOR = levels;
+  *addressPCOR = mask & ~levels;
+}
+
+void mkl_DevGPIOBus::set(uint32_t value) {
+  *addressPSOR = scatter(value);
+}
+
+void mkl_DevGPIOBus::clear(uint32_t value) {
+  *addressPCOR = scatter(value);
+}
+
+uint32_t mkl_DevGPIOBus::read() const {
+  return gather(*addressPDIR);
+}
+
+void mkl_DevGPIOBus::setDirection(uint32_t outputs) {
+  uint32_t pins = scatter(outputs);
+
+  if (fieldPDDR != nullptr) {
+    *fieldPDDR = pins;
+    return;
+  }
+
+  setPortMode(pins, gpio_output);
+  setPortMode(mask & ~pins, gpio_input);
+}
+
+void mkl_DevGPIOBus::setBusMode(gpio_PortMode mode) {
+  setPortMode(mask, mode);
+}
@@ -0,0 +1,134 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Barramento de pinos arbitrários de uma porta GPIO, lido e escrito como um valor.
+ *
+ * @file        mkl_DevGPIOBus.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "mkl_DevGPIOPort.h"
+
+// Número máximo de pinos em um barramento
+#define GPIO_BUS_MAX_WIDTH 16
+
+/*!
+ * Trecho do barramento cujos pinos são consecutivos tanto nos bits do valor
+ * quanto na porta: os bits do valor em busMask vão para os pinos em portMask
+ * com um único deslocamento.
+ */
+struct gpio_BusRun {
+	uint32_t busMask;
+	uint32_t portMask;
+	int8_t shift;			// Pino na porta menos bit no valor
+};
+
+/*!
+ *  @class    mkl_DevGPIOBus
+ *
+ *  @brief    Pinos quaisquer de uma porta tratados como um único valor.
+ *
+ *  @details  O bit k do valor corresponde ao k-ésimo pino passado ao
+ *            construtor. A conversão entre o valor e a máscara da porta usa uma
+ *            tabela de trechos montada no construtor: cada trecho de pinos
+ *            consecutivos custa um AND e um deslocamento, de modo que um
+ *            barramento contíguo é convertido em um passo e um barramento
+ *            espalhado em um passo por trecho, sem laço por pino.
+ *
+ *            Com gpio_bridge, um barramento contíguo de até 16 pinos é
+ *            escrito, e tem a direção trocada, com uma única escrita BFI do BME
+ *            no PDOR ou no PDDR, indivisível no barramento. O BME não alcança o
+ *            FGPIO, então com gpio_fast, e nos demais casos, write() usa o PSOR e
+ *            depois o PCOR, e setDirection() chama setPortMode() para as saídas
+ *            e depois para as entradas; cada escrita é indivisível (exceto o
+ *            PDDR com gpio_fast, veja gpio_AccessPath), mas há um instante
+ *            entre as duas. read() é uma única leitura do PDIR.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              const gpio_Pin pins[] = { gpio_PTC3, gpio_PTC4, gpio_PTC5, gpio_PTC7 };
+ *              mkl_DevGPIOBus bus(pins, 4, gpio_fast);
+ *              bus.setBusMode(gpio_output);
+ *              bus.write(0x9);		// PTC3 e PTC7 em 1, PTC4 e PTC5 em 0
+ *              bus.setBusMode(gpio_input);
+ *              uint32_t value = bus.read();
+ */
+class mkl_DevGPIOBus : public mkl_DevGPIOPort {
+public:
+	/*!
+	 * Configura os pinos como GPIO com pull up, em entrada e com nível 0.
+	 *
+	 * Pinos fora da porta do primeiro, ou além de GPIO_BUS_MAX_WIDTH, são
+	 * ignorados; getWidth() retorna o número de pinos aceitos, na ordem dada.
+	 * Com count 0 o barramento é vazio e pins não é lido.
+	 */
+	mkl_DevGPIOBus(const gpio_Pin pins[], uint8_t count,
+			gpio_AccessPath accessPath = GPIO_DEFAULT_ACCESS_PATH);
+
+	uint8_t getWidth() const;
+
+	/*!
+	 * Converte um valor do barramento na máscara da porta e vice-versa.
+	 */
+	uint32_t scatter(uint32_t value) const;
+	uint32_t gather(uint32_t levels) const;
+
+	/*!
+	 * Escreve o valor em todos os pinos do barramento.
+	 */
+	void write(uint32_t value);
+
+	/*!
+	 * Levam a 1 ou a 0 os pinos dos bits em 1 de @ref value, em uma escrita
+	 * do PSOR ou do PCOR.
+	 */
+	void set(uint32_t value);
+	void clear(uint32_t value);
+
+	/*!
+	 * Lê todos os pinos do barramento em uma leitura do PDIR.
+	 */
+	uint32_t read() const;
+
+	/*!
+	 * Define a direção de cada pino: bits em 1 do valor viram saída.
+	 */
+	void setDirection(uint32_t outputs);
+
+	/*!
+	 * Leva todos os pinos a @ref mode em uma única escrita do BME.
+	 */
+	void setBusMode(gpio_PortMode mode);
+
+private:
+	static uint32_t collectMask(const gpio_Pin pins[], uint8_t count);
+
+	gpio_BusRun runs[GPIO_BUS_MAX_WIDTH];
+	uint8_t runCount = 0;
+	uint8_t width = 0;
+
+	/*!
+	 * Endereços BFI do BME para o PDOR e o PDDR, em barramentos contíguos de até
+	 * 16 pinos com gpio_bridge (nulos nos demais).
+	 */
+	volatile uint32_t *fieldPDOR = nullptr;
+	volatile uint32_t *fieldPDDR = nullptr;
+};
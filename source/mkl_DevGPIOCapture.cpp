@@ -0,0 +1,200 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Captura por DMA de marcas de tempo ou do PDIR a cada borda de um pino.
+ *
+ * @file        mkl_DevGPIOCapture.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_DevGPIOCapture.h"
+#include "mkl_DevGPIOEvents.h"
+#include "fsl_dmamux.h"
+
+static void dmaCallback(dma_handle_t *handle, void *userData) {
+  static_cast<mkl_DevGPIOCapture *>(userData)->handleComplete();
+}
+
+mkl_DevGPIOCapture::mkl_DevGPIOCapture(gpio_Pin pin, gpio_CaptureSource source,
+                                       uint8_t channel)
+    : input(pin) {
+  pinName = pin;
+  captureSource = source;
+  dmaChannel = channel;
+}
+
+bool mkl_DevGPIOCapture::begin(uint32_t buffer[], uint32_t count,
+                               gpio_InterruptTrigger trigger, bool circular) {
+  uint32_t GPIONumber = (uint32_t)pinName >> 8;
+  uint32_t bytes = count * 4;
+
+  // Só PTA e PTD têm fonte de DMA no DMAMUX do KL25
+  if ((GPIONumber != 0 && GPIONumber != 3) || trigger >= gpio_whenLogicZero
+      || dmaChannel >= FSL_FEATURE_DMA_MODULE_CHANNEL || count == 0) {
+    return false;
+  }
+
+  uint32_t modulo = 0;
+  if (circular) {
+    // Anel pelo módulo de destino: 16 bytes a 256 KB, alinhado ao tamanho
+    if ((bytes & (bytes - 1)) != 0 || bytes < 16 || bytes > 0x40000
+        || ((uint32_t)(uintptr_t)buffer & (bytes - 1)) != 0) {
+      return false;
+    }
+    while ((16UL << modulo) < bytes) {
+      modulo++;
+    }
+  } else if (bytes > GPIO_CAPTURE_MAX_BYTES) {
+    return false;
+  }
+
+  if (captureSource == gpio_captureTimestamp
+      && !mkl_DevGPIOEvents::isRunning()) {
+    mkl_DevGPIOEvents::begin();
+  }
+
+  // O DMA não alcança o alias FGPIO; o PDIR é lido pela ponte de periféricos
+  void *source = (captureSource == gpio_captureTimestamp)
+                     ? (void *)&TPM1->CNT
+                     : (void *)(GPIOA_BASE + 0x40*GPIONumber + 0x10);
+
+  DMAMUX_Init(DMAMUX0);
+  DMAMUX_SetSource(DMAMUX0, dmaChannel,
+                   (uint32_t)(GPIONumber == 0 ? kDmaRequestMux0PortA
+                                              : kDmaRequestMux0PortD));
+  DMAMUX_EnableChannel(DMAMUX0, dmaChannel);
+
+  DMA_Init(DMA0);
+  DMA_CreateHandle(&dmaHandle, DMA0, dmaChannel);
+  DMA_SetCallback(&dmaHandle, dmaCallback, this);
+
+  data = buffer;
+  size = count;
+  ring = circular;
+  completedBytes = 0;
+
+  // Um pedido por borda (cycle steal), uma palavra por pedido
+  dma_transfer_config_t config;
+  DMA_PrepareTransfer(&config, source, 4, buffer, 4, bytes,
+                      kDMA_PeripheralToMemory);
+  DMA_SubmitTransfer(&dmaHandle, &config, kDMA_EnableInterrupt);
+
+  armedBytes = bytes;
+  if (circular) {
+    // O maior múltiplo do anel que cabe no contador de bytes, de modo que o
+    // rearme não desloca o índice
+    armedBytes = (GPIO_CAPTURE_MAX_BYTES / bytes) * bytes;
+    DMA_SetTransferSize(DMA0, dmaChannel, armedBytes);
+    DMA_SetModulo(DMA0, dmaChannel, kDMA_ModuloDisable,
+                  (dma_modulo_t)(kDMA_Modulo16Bytes + modulo));
+  }
+
+  DMA_StartTransfer(&dmaHandle);
+
+  // Erro de configuração: o canal não transfere e o pino não é armado
+  if ((DMA0->DMA[dmaChannel].DSR_BCR & DMA_DSR_BCR_CE_MASK) != 0) {
+    DMA_AbortTransfer(&dmaHandle);
+    DMAMUX_DisableChannel(DMAMUX0, dmaChannel);
+    armedBytes = 0;
+    return false;
+  }
+
+  running = true;
+  input.enableInterrupt(trigger);
+
+  return true;
+}
+
+void mkl_DevGPIOCapture::end() {
+  if (!running) {
+    return;
+  }
+
+  input.disableInterrupt();
+  DMA_AbortTransfer(&dmaHandle);
+  completedBytes += armedBytes - DMA_GetRemainingBytes(DMA0, dmaChannel);
+  armedBytes = 0;
+  DMAMUX_DisableChannel(DMAMUX0, dmaChannel);
+  running = false;
+}
+
+bool mkl_DevGPIOCapture::isRunning() const {
+  return running;
+}
+
+uint32_t mkl_DevGPIOCapture::getCount() const {
+  uint32_t completed;
+  uint32_t remaining;
+
+  if (!running) {
+    return completedBytes / 4;
+  }
+
+  // Repete se a interrupção de fim concluiu um trecho entre as duas leituras
+  do {
+    completed = completedBytes;
+    remaining = DMA_GetRemainingBytes(DMA0, dmaChannel);
+  } while (completed != completedBytes);
+
+  return (completed + armedBytes - remaining) / 4;
+}
+
+uint32_t mkl_DevGPIOCapture::getIndex() const {
+  uint32_t count = getCount();
+
+  return ring ? count & (size - 1) : count;
+}
+
+uint32_t mkl_DevGPIOCapture::getInterval() const {
+  uint32_t count = getCount();
+
+  if (captureSource != gpio_captureTimestamp || count < 2) {
+    return 0;
+  }
+
+  uint32_t last = count - 1;
+  uint32_t previous = count - 2;
+  if (ring) {
+    last &= size - 1;
+    previous &= size - 1;
+  }
+
+  return (data[last] - data[previous]) & 0xFFFF;
+}
+
+uint32_t mkl_DevGPIOCapture::getRate() const {
+  uint32_t interval = getInterval();
+
+  return (interval != 0) ? mkl_DevGPIOEvents::getTimestampRate() / interval : 0;
+}
+
+void mkl_DevGPIOCapture::handleComplete() {
+  completedBytes += armedBytes;
+
+  if (ring) {
+    // O endereço de destino continua no anel; só o contador é recarregado
+    DMA_SetTransferSize(DMA0, dmaChannel, armedBytes);
+    DMA_EnableChannelRequest(DMA0, dmaChannel);
+    return;
+  }
+
+  armedBytes = 0;
+  running = false;
+  input.disableInterrupt();
+  exec();
+}
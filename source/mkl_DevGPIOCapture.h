@@ -0,0 +1,147 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Captura por DMA de marcas de tempo ou do PDIR a cada borda de um pino.
+ *
+ * @file        mkl_DevGPIOCapture.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "fsl_dma.h"
+#include "mkl_DevGPIO.h"
+#include "Callback.h"
+
+/*!
+ * Maior contador de bytes aceito pelo DMA do KL25 (20 bits).
+ *
+ * O campo BCR do DSR_BCR tem 24 bits no CMSIS, mas valores acima deste
+ * ligam DSR_BCR[CE] e o canal não transfere.
+ */
+#define GPIO_CAPTURE_MAX_BYTES 0xFFFFFUL
+
+/*!
+ * Registrador copiado a cada borda.
+ */
+typedef enum : uint8_t {
+	gpio_captureTimestamp = 0,	// Contador do TPM1 (mkl_DevGPIOEvents)
+	gpio_capturePort = 1		// PDIR da porta do pino
+} gpio_CaptureSource;
+
+/*!
+ *  @class    mkl_DevGPIOCapture
+ *
+ *  @brief    Canal de DMA que registra cada borda de um pino, sem uso do núcleo.
+ *
+ *  @details  O pino é armado com um modo gpio_dma* do IRQC: cada borda gera um
+ *            pedido de DMA da porta (PTA ou PTD) e o canal copia uma palavra
+ *            de 32 bits, o contador do TPM1 ou o PDIR da porta, para o próximo
+ *            elemento do vetor. A flag do pino é limpa pelo próprio DMA.
+ *
+ *            Em modo simples o vetor é preenchido uma vez e exec() é chamado
+ *            pela interrupção de fim do DMA. Em modo circular o vetor é um anel
+ *            (módulo de destino do DMA): o número de elementos deve ser uma
+ *            potência de 2 de 4 a 65536, e o vetor deve estar alinhado ao seu
+ *            tamanho em bytes. O canal é rearmado pela interrupção a cada cerca
+ *            de 1 MB transferido; bordas durante o rearme são perdidas.
+ *
+ *            Cada porta tem uma única fonte no DMAMUX, então só um pino por
+ *            porta pode ser capturado. O canal de DMA padrão, 3, não conflita
+ *            com os canais padrão de TM1637DmaBus (0 e, com ackSample, 2); se
+ *            o barramento usar outros canais, escolha um canal livre aqui.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              static uint32_t edges[64] __attribute__((aligned(256)));
+ *              mkl_DevGPIOCapture capture(gpio_PTA13);
+ *              capture.begin(edges, 64, gpio_dmaOnRisingEdge, true);
+ *              uint32_t hz = capture.getRate();
+ */
+class mkl_DevGPIOCapture : public Callback {
+public:
+	mkl_DevGPIOCapture(gpio_Pin pin,
+			gpio_CaptureSource source = gpio_captureTimestamp,
+			uint8_t channel = 3);
+
+	/*!
+	 * Configura DMAMUX e DMA e arma o pino.
+	 *
+	 * Com gpio_captureTimestamp, o TPM1 é iniciado se ainda não estiver
+	 * contando.
+	 *
+	 * @return false se o pino não estiver em PTA ou PTD, se o modo não for
+	 *         gpio_dma*, se o vetor não servir para o modo escolhido, ou se
+	 *         o DMA acusar erro de configuração (DSR_BCR[CE])
+	 */
+	bool begin(uint32_t buffer[], uint32_t count,
+			gpio_InterruptTrigger trigger = gpio_dmaOnRisingEdge,
+			bool circular = false);
+
+	/*!
+	 * Desarma o pino e para o canal.
+	 */
+	void end();
+
+	bool isRunning() const;
+
+	/*!
+	 * Número de bordas capturadas desde begin().
+	 */
+	uint32_t getCount() const;
+
+	/*!
+	 * Índice do elemento que receberá a próxima captura.
+	 */
+	uint32_t getIndex() const;
+
+	/*!
+	 * Contagens do TPM1 entre as duas últimas bordas (0 se houver menos de
+	 * duas), módulo 65536.
+	 */
+	uint32_t getInterval() const;
+
+	/*!
+	 * Frequência das bordas, em Hz, a partir de getInterval().
+	 */
+	uint32_t getRate() const;
+
+	/*!
+	 * Trata o fim do contador de bytes; chamado pela interrupção do canal de DMA.
+	 */
+	void handleComplete();
+
+private:
+	mkl_DevGPIO input;
+	gpio_Pin pinName;
+	gpio_CaptureSource captureSource;
+	uint8_t dmaChannel;
+	dma_handle_t dmaHandle;
+
+	uint32_t *data = nullptr;
+	uint32_t size = 0;
+	bool ring = false;
+
+	/*!
+	 * Bytes do trecho armado e bytes de trechos já concluídos.
+	 */
+	uint32_t armedBytes = 0;
+	volatile uint32_t completedBytes = 0;
+	volatile bool running = false;
+};
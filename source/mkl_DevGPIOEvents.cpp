@@ -0,0 +1,97 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Fila de eventos de borda do GPIO com marca de tempo do TPM1.
+ *
+ * @file        mkl_DevGPIOEvents.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_DevGPIOEvents.h"
+
+/*!
+ * Divisor do clock do TPM1 escolhido em begin()
+ */
+static uint8_t timestampPrescale = 0;
+
+void mkl_DevGPIOEvents::begin(tpm_clock_prescale_t prescale) {
+  tpm_config_t config;
+
+  CLOCK_SetTpmClock(1U);
+  TPM_GetDefaultConfig(&config);
+  config.prescale = prescale;
+  TPM_Init(TPM1, &config);
+  TPM_SetTimerPeriod(TPM1, 0xFFFF);
+
+  timestampPrescale = (uint8_t)prescale;
+  TPM_StartTimer(TPM1, kTPM_SystemClock);
+}
+
+bool mkl_DevGPIOEvents::isRunning() {
+  // Sem o clock do módulo, qualquer acesso ao TPM1 gera falha de barramento
+  if (!(SIM->SCGC6 & SIM_SCGC6_TPM1_MASK)) {
+    return false;
+  }
+
+  return (TPM1->SC & TPM_SC_CMOD_MASK) != 0;
+}
+
+uint32_t mkl_DevGPIOEvents::getTimestampRate() {
+  return CLOCK_GetPllFllSelClkFreq() >> timestampPrescale;
+}
+
+uint8_t mkl_DevGPIOEvents::read(gpio_EdgeEvent events[], uint8_t max) {
+  // head é lido uma vez e tail é escrito uma vez por lote
+  uint8_t last = head;
+  uint8_t index = tail;
+  uint8_t count = 0;
+  uint8_t depth = (last - index) & (GPIO_EVENT_QUEUE_DEPTH - 1);
+
+  // A ocupação é medida aqui, e não em push(), para não pesar na interrupção
+  if (depth > stats.maxDepth) {
+    stats.maxDepth = depth;
+  }
+
+  // As barreiras impedem o compilador de ler os eventos antes de head, ou de
+  // liberar as posições (tail) antes de terminar a cópia
+  __DMB();
+  while (index != last && count < max) {
+    events[count++] = queue[index];
+    index = (index + 1) & (GPIO_EVENT_QUEUE_DEPTH - 1);
+  }
+
+  __DMB();
+  tail = index;
+  return count;
+}
+
+uint8_t mkl_DevGPIOEvents::available() const {
+  uint8_t depth = (head - tail) & (GPIO_EVENT_QUEUE_DEPTH - 1);
+
+  return depth;
+}
+
+gpio_EventStats mkl_DevGPIOEvents::getStats() const {
+  return stats;
+}
+
+void mkl_DevGPIOEvents::resetStats() {
+  stats.events = 0;
+  stats.overflows = 0;
+  stats.maxDepth = 0;
+}
@@ -0,0 +1,163 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Fila de eventos de borda do GPIO com marca de tempo do TPM1.
+ *
+ * @file        mkl_DevGPIOEvents.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "MKL25Z4.h"
+#include "fsl_tpm.h"
+
+// Número de eventos na fila (potência de 2)
+#define GPIO_EVENT_QUEUE_DEPTH 64
+
+/*!
+ * Borda que gerou o evento.
+ */
+typedef enum : uint8_t {
+	gpio_fallingEdge = 0, gpio_risingEdge = 1
+} gpio_Edge;
+
+/*!
+ * Evento de borda registrado pela interrupção da porta.
+ */
+struct gpio_EdgeEvent {
+	uint16_t pin;			// O gpio_Pin que sofreu a borda
+	uint16_t timestamp;		// Contagem do TPM1 na entrada da interrupção
+	gpio_Edge edge;
+};
+
+/*!
+ * Estatísticas da fila.
+ */
+struct gpio_EventStats {
+	uint32_t events;		// Eventos gravados
+	uint32_t overflows;		// Eventos perdidos com a fila cheia
+	uint8_t maxDepth;		// Maior ocupação encontrada por read()
+};
+
+/*!
+ *  @class    mkl_DevGPIOEvents
+ *
+ *  @brief    Fila sem travas de eventos de borda (pino, borda, marca de tempo).
+ *
+ *  @details  Pinos habilitados com mkl_DevGPIO::enableEvents() não chamam exec()
+ *            na interrupção: o tratador da porta só grava um gpio_EdgeEvent
+ *            nesta fila, e o laço principal retira os eventos em lotes com
+ *            read(). A interrupção só escreve head e read() só escreve tail; a
+ *            fila é um vetor fixo e nunca aloca memória. Com a fila cheia o
+ *            evento novo é descartado e contado em overflows.
+ *
+ *            A marca de tempo é o contador do TPM1, livre e de 16 bits, lido
+ *            uma vez por interrupção da porta: eventos da mesma interrupção
+ *            têm a mesma marca. Intervalos maiores que um período do contador
+ *            (65536 contagens) não podem ser distinguidos pela diferença das
+ *            marcas.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              mkl_DevGPIOEvents events;
+ *              mkl_DevGPIOEvents::begin();
+ *              mkl_DevGPIO input(gpio_PTA12);
+ *              input.enableEvents(gpio_onEitherEdge, events);
+ *              gpio_EdgeEvent batch[8];
+ *              uint8_t n = events.read(batch, 8);
+ */
+class mkl_DevGPIOEvents {
+public:
+	/*!
+	 * Inicia o TPM1 em contagem livre (módulo 0xFFFF), sem interrupção, no
+	 * clock PLL/FLL dividido por @ref prescale. O TPM1 fica reservado para
+	 * as marcas de tempo.
+	 */
+	static void begin(tpm_clock_prescale_t prescale = kTPM_Prescale_Divide_1);
+
+	/*!
+	 * Indica se o TPM1 já está contando.
+	 */
+	static bool isRunning();
+
+	/*!
+	 * Frequência de contagem do TPM1, em Hz, para converter as marcas.
+	 */
+	static uint32_t getTimestampRate();
+
+	/*!
+	 * Contagem atual do TPM1.
+	 */
+	static uint16_t timestamp() {
+		return (uint16_t)TPM1->CNT;
+	}
+
+	/*!
+	 * Grava um evento; chamado pelo tratador de interrupção da porta.
+	 *
+	 * Definido aqui para que a interrupção não pague uma chamada de função.
+	 */
+	void push(uint16_t pin, gpio_Edge edge, uint16_t time) {
+		uint8_t next = (head + 1) & (GPIO_EVENT_QUEUE_DEPTH - 1);
+
+		if (next == tail) {
+			stats.overflows++;
+			return;
+		}
+
+		queue[head].pin = pin;
+		queue[head].timestamp = time;
+		queue[head].edge = edge;
+
+		// O evento precisa estar gravado antes de head o publicar
+		__DMB();
+		head = next;
+		stats.events++;
+	}
+
+	/*!
+	 * Retira até @ref max eventos, do mais antigo ao mais novo.
+	 *
+	 * @return O número de eventos copiados para @ref events
+	 */
+	uint8_t read(gpio_EdgeEvent events[], uint8_t max);
+
+	/*!
+	 * Número de eventos aguardando na fila.
+	 */
+	uint8_t available() const;
+
+	/*!
+	 * Retorna as estatísticas acumuladas desde a última chamada de resetStats().
+	 */
+	gpio_EventStats getStats() const;
+
+	void resetStats();
+
+private:
+	/*!
+	 * Fila de eventos: head é escrito pela interrupção e tail pelo laço principal.
+	 */
+	gpio_EdgeEvent queue[GPIO_EVENT_QUEUE_DEPTH];
+	volatile uint8_t head = 0;
+	volatile uint8_t tail = 0;
+
+	gpio_EventStats stats = { 0, 0, 0 };
+};
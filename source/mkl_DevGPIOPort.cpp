@@ -0,0 +1,111 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Acesso a vários pinos de uma porta GPIO por máscara.
+ *
+ * @file        mkl_DevGPIOPort.cpp
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_DevGPIOPort.h"
+
+mkl_DevGPIOPort::mkl_DevGPIOPort() {
+  mask = 0;
+}
+
+mkl_DevGPIOPort::mkl_DevGPIOPort(gpio_Name port, uint32_t pins,
+                                 gpio_AccessPath accessPath) {
+  uint32_t GPIONumber = (uint32_t)port >> 8;
+  uint32_t gpioBase = (accessPath == gpio_fast) ? FGPIOA_BASE : GPIOA_BASE;
+  uint32_t baseAddress = gpioBase + 0x40*GPIONumber;
+
+  addressPSOR = (volatile uint32_t *)(baseAddress + 0x4);
+  addressPCOR = (volatile uint32_t *)(baseAddress + 0x8);
+  addressPTOR = (volatile uint32_t *)(baseAddress + 0xC);
+  addressPDIR = (volatile uint32_t *)(baseAddress + 0x10);
+  addressPDDR = (volatile uint32_t *)(baseAddress + 0x14);
+
+  // Escritas do BME pelo alias do GPIO, como em mkl_DevGPIO; nulos com
+  // gpio_fast, que lê e reescreve o PDDR pelo FGPIO
+  addressPDDRSet = nullptr;
+  addressPDDRClear = nullptr;
+  if (accessPath != gpio_fast) {
+    addressPDDRSet = (volatile uint32_t *)BME_OR(GPIO_BME_ALIAS_BASE
+                       + 0x40*GPIONumber + 0x14);
+    addressPDDRClear = (volatile uint32_t *)BME_AND(GPIO_BME_ALIAS_BASE
+                         + 0x40*GPIONumber + 0x14);
+  }
+
+  mask = pins;
+
+  SIM_SCGC5 |= SIM_SCGC5_PORTA_MASK << GPIONumber;
+  for (uint32_t pin = 0; pin < 32; pin++) {
+    if (pins & (1UL << pin)) {
+      *(volatile uint32_t *)(0x40049000 + 0x1000*GPIONumber + 4*pin) =
+          PORT_PCR_MUX(1) | gpio_pullUpResistor;
+    }
+  }
+
+  setPortMode(mask, gpio_input);
+  *addressPCOR = mask;
+}
+
+uint32_t mkl_DevGPIOPort::pinMask(gpio_Pin pin) {
+  return 1UL << (pin & 0xFF);
+}
+
+uint32_t mkl_DevGPIOPort::getMask() const {
+  return mask;
+}
+
+void mkl_DevGPIOPort::writeDirection(uint32_t outputs) {
+  *addressPDDR = (*addressPDDR & ~mask) | (outputs & mask);
+}
+
+void mkl_DevGPIOPort::setPortMode(uint32_t pins, gpio_PortMode mode) {
+  if (addressPDDRSet == nullptr) {
+    if (mode == gpio_input) {
+      *addressPDDR &= ~(pins & mask);
+    } else {
+      *addressPDDR |= pins & mask;
+    }
+    return;
+  }
+
+  if (mode == gpio_input) {
+    *addressPDDRClear = ~(pins & mask);
+  } else {
+    *addressPDDRSet = pins & mask;
+  }
+}
+
+void mkl_DevGPIOPort::setBits(uint32_t pins) {
+  *addressPSOR = pins & mask;
+}
+
+void mkl_DevGPIOPort::clearBits(uint32_t pins) {
+  *addressPCOR = pins & mask;
+}
+
+void mkl_DevGPIOPort::toogleBits(uint32_t pins) {
+  *addressPTOR = pins & mask;
+}
+
+uint32_t mkl_DevGPIOPort::readPort() const {
+  return *addressPDIR & mask;
+}
@@ -0,0 +1,108 @@
+/*!
+ * @copyright   � 2020 Caio Arthur Sales Telles <csalestelles@gmail.com>
+ *
+ * @brief       Acesso a vários pinos de uma porta GPIO por máscara.
+ *
+ * @file        mkl_DevGPIOPort.h
+ * @version     1.0
+ * @date        17 de outubro de 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     MCUXpresso IDE
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012
+ *              +revisions    Versão(data): Descrição breve.
+ *                             ++ 1.0 (17 de outubro de 2026): Versão inicial.
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL).
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "MKL25Z.h"
+#include "mkl_DevGPIO.h"
+
+/*!
+ *  @class    mkl_DevGPIOPort
+ *
+ *  @brief    Grupo de pinos de uma mesma porta GPIO, acessados por máscara.
+ *
+ *  @details  Complementa mkl_DevGPIO quando vários pinos precisam mudar no
+ *            mesmo instante: cada método recebe uma máscara de bits da porta e
+ *            faz uma única escrita no registrador. Apenas os pinos da máscara
+ *            passada ao construtor são afetados.
+ *
+ *            writeDirection() lê e reescreve o PDDR; os demais pinos da porta
+ *            não devem mudar de direção por interrupções durante o seu uso.
+ *            setPortMode() usa o BME e é seguro nesse caso,
+ *            exceto com gpio_fast, em que também lê e reescreve o PDDR pelo
+ *            FGPIO (veja gpio_AccessPath).
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *              mkl_DevGPIOPort port(gpio_GPIOC, 0x0F, gpio_fast);
+ *              port.writeDirection(0x05);	// PTC0 e PTC2 saída, PTC1 e PTC3 entrada
+ *              uint32_t levels = port.readPort();
+ */
+class mkl_DevGPIOPort {
+public:
+	mkl_DevGPIOPort();
+
+	/*!
+	 * Configura como GPIO com pull up os pinos de @ref pins na porta @ref port.
+	 *
+	 * Os pinos começam como entrada e com nível de saída 0.
+	 */
+	mkl_DevGPIOPort(gpio_Name port, uint32_t pins,
+			gpio_AccessPath accessPath = GPIO_DEFAULT_ACCESS_PATH);
+
+	/*!
+	 * Máscara de um pino dentro da sua porta.
+	 */
+	static uint32_t pinMask(gpio_Pin pin);
+
+	/*!
+	 * Máscara dos pinos controlados pelo objeto.
+	 */
+	uint32_t getMask() const;
+
+	/*!
+	 * Define a direção de todos os pinos da máscara em uma única escrita:
+	 * bits em 1 viram saída e bits em 0 viram entrada.
+	 */
+	void writeDirection(uint32_t outputs);
+
+	/*!
+	 * Muda para @ref mode apenas os pinos de @ref pins (escrita do BME, ou
+	 * leitura e escrita do PDDR com gpio_fast).
+	 */
+	void setPortMode(uint32_t pins, gpio_PortMode mode);
+
+	/*!
+	 * Métodos de escrita pelos registradores PSOR, PCOR e PTOR.
+	 */
+	void setBits(uint32_t pins);
+	void clearBits(uint32_t pins);
+	void toogleBits(uint32_t pins);
+
+	/*!
+	 * Lê o PDIR de uma vez, já mascarado.
+	 */
+	uint32_t readPort() const;
+
+protected:
+	volatile uint32_t *addressPDDR;
+	volatile uint32_t *addressPDDRSet;
+	volatile uint32_t *addressPDDRClear;
+	volatile uint32_t *addressPSOR;
+	volatile uint32_t *addressPCOR;
+	volatile uint32_t *addressPTOR;
+	volatile uint32_t *addressPDIR;
+	uint32_t mask;
+};